@@ -0,0 +1,297 @@
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+#include <map>
+#include <thread>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <boost/format.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/algorithm/string/classification.hpp>
+
+#include "proto/trippath.pb.h"
+#include "proto/tripdirections.pb.h"
+#include "proto/directions_options.pb.h"
+#include "odin/directionsbuilder.h"
+#include "odin/stage_times.h"
+#include "odin/util.h"
+
+using namespace valhalla::odin;
+
+// Count the allocations of each thread so the allocations of a single leg
+// can be measured while other threads are building directions
+namespace {
+thread_local uint64_t allocation_count = 0;
+}
+
+void* operator new(size_t size) {
+  ++allocation_count;
+  void* ptr = std::malloc(size ? size : 1);
+  if (!ptr)
+    throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+namespace {
+
+constexpr auto kUsage =
+    "usage: odin_bench <trip_path_directory> [--iterations N] [--threads N]"
+    " [--locales en-US,de-DE,...] [--units kilometers|miles]";
+
+struct options_t {
+  std::string directory;
+  size_t iterations = 10;
+  size_t threads = 1;
+  std::vector<std::string> locales = { "en-US" };
+  DirectionsOptions::Units units = DirectionsOptions_Units_kKilometers;
+};
+
+// Measurements of one leg
+struct sample_t {
+  size_t group;
+  StageTimes stage_times;
+  uint64_t allocations;
+};
+
+// Measurements of every leg of a locale and travel mode
+struct group_t {
+  std::vector<uint64_t> stage_nanoseconds[StageTimes::kStageCount];
+  std::vector<uint64_t> total_nanoseconds;
+  uint64_t allocations = 0;
+};
+
+options_t ParseOptions(int argc, char** argv) {
+  options_t options;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg.compare(0, 2, "--") != 0) {
+      options.directory = arg;
+      continue;
+    }
+    if (i + 1 >= argc)
+      throw std::runtime_error(kUsage);
+    std::string value = argv[++i];
+    if (arg == "--iterations") {
+      options.iterations = std::stoul(value);
+    } else if (arg == "--threads") {
+      options.threads = std::max(std::stoul(value), 1ul);
+    } else if (arg == "--locales") {
+      options.locales.clear();
+      boost::split(options.locales, value, boost::is_any_of(","));
+    } else if (arg == "--units") {
+      if (value == "miles")
+        options.units = DirectionsOptions_Units_kMiles;
+      else if (value != "kilometers")
+        throw std::runtime_error(kUsage);
+    } else {
+      throw std::runtime_error(kUsage);
+    }
+  }
+  if (options.directory.empty())
+    throw std::runtime_error(kUsage);
+
+  for (const auto& locale : options.locales) {
+    if (get_locales().find(locale) == get_locales().end())
+      throw std::runtime_error("Unsupported locale: " + locale);
+  }
+  return options;
+}
+
+// Loads every serialized trip path of the directory in file name order
+std::vector<TripPath> LoadCorpus(const std::string& directory) {
+  DIR* dir = opendir(directory.c_str());
+  if (!dir)
+    throw std::runtime_error("Cannot open directory: " + directory);
+
+  std::vector<std::string> file_names;
+  while (dirent* entry = readdir(dir)) {
+    std::string path = directory + "/" + entry->d_name;
+    struct stat status;
+    if ((stat(path.c_str(), &status) == 0) && S_ISREG(status.st_mode))
+      file_names.emplace_back(std::move(path));
+  }
+  closedir(dir);
+  std::sort(file_names.begin(), file_names.end());
+
+  std::vector<TripPath> corpus;
+  for (const auto& file_name : file_names) {
+    std::ifstream file(file_name, std::ios::binary);
+    std::stringstream bytes;
+    bytes << file.rdbuf();
+    TripPath trip_path;
+    if (!trip_path.ParseFromString(bytes.str()) || (trip_path.node_size() < 1)) {
+      std::cerr << "Skipping " << file_name << ": not a trip path" << std::endl;
+      continue;
+    }
+    corpus.emplace_back(std::move(trip_path));
+  }
+  if (corpus.empty())
+    throw std::runtime_error("No trip paths in directory: " + directory);
+  return corpus;
+}
+
+std::string GetTravelModeName(const TripPath& trip_path) {
+  for (const auto& node : trip_path.node()) {
+    if (node.has_edge())
+      return TripPath_TravelMode_Name(node.edge().travel_mode());
+  }
+  return "none";
+}
+
+// Builds the directions of the whole corpus for each locale
+void Run(const options_t& options, const std::vector<TripPath>& corpus,
+         const std::vector<size_t>& mode_groups, std::vector<sample_t>& samples,
+         size_t& errors) {
+  size_t mode_count = *std::max_element(mode_groups.begin(), mode_groups.end()) + 1;
+  for (size_t l = 0; l < options.locales.size(); ++l) {
+    DirectionsOptions directions_options;
+    directions_options.set_language(options.locales[l]);
+    directions_options.set_units(options.units);
+    directions_options.set_narrative(true);
+
+    for (size_t iteration = 0; iteration < options.iterations; ++iteration) {
+      for (size_t p = 0; p < corpus.size(); ++p) {
+        // Building updates the trip path so each leg works on a copy
+        TripPath trip_path = corpus[p];
+        sample_t sample;
+        sample.group = l * mode_count + mode_groups[p];
+        uint64_t allocations = allocation_count;
+        try {
+          DirectionsBuilder directions;
+          TripDirections trip_directions = directions.Build(
+              directions_options, trip_path, &sample.stage_times);
+        } catch (...) {
+          ++errors;
+          continue;
+        }
+        sample.allocations = allocation_count - allocations;
+        samples.emplace_back(std::move(sample));
+      }
+    }
+  }
+}
+
+uint64_t Percentile(std::vector<uint64_t>& values, double percentile) {
+  if (values.empty())
+    return 0;
+  size_t index = static_cast<size_t>(percentile * (values.size() - 1) + 0.5);
+  std::nth_element(values.begin(), values.begin() + index, values.end());
+  return values[index];
+}
+
+void Report(const std::string& name, group_t& group) {
+  size_t legs = group.total_nanoseconds.size();
+  uint64_t total = 0;
+  for (auto nanoseconds : group.total_nanoseconds)
+    total += nanoseconds;
+
+  std::cout << boost::format("%1%: %2% legs, %3$.1f legs/s, %4$.1f allocations/leg")
+      % name % legs % (total ? legs * 1e9 / total : 0.0)
+      % (legs ? static_cast<double>(group.allocations) / legs : 0.0) << std::endl;
+  std::cout << boost::format("  %-16s %12s %12s") % "stage" % "p50 (us)"
+      % "p99 (us)" << std::endl;
+  for (size_t s = 0; s < StageTimes::kStageCount; ++s) {
+    auto& values = group.stage_nanoseconds[s];
+    std::cout << boost::format("  %-16s %12.1f %12.1f")
+        % StageTimes::GetStageName(static_cast<StageTimes::Stage>(s))
+        % (Percentile(values, 0.5) / 1e3) % (Percentile(values, 0.99) / 1e3)
+        << std::endl;
+  }
+  std::cout << boost::format("  %-16s %12.1f %12.1f") % "total"
+      % (Percentile(group.total_nanoseconds, 0.5) / 1e3)
+      % (Percentile(group.total_nanoseconds, 0.99) / 1e3) << std::endl;
+}
+
+}
+
+int main(int argc, char** argv) {
+  options_t options;
+  std::vector<TripPath> corpus;
+  try {
+    options = ParseOptions(argc, argv);
+    corpus = LoadCorpus(options.directory);
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Group the trip paths by travel mode
+  std::vector<std::string> modes;
+  std::vector<size_t> mode_groups;
+  for (const auto& trip_path : corpus) {
+    std::string mode = GetTravelModeName(trip_path);
+    auto found = std::find(modes.begin(), modes.end(), mode);
+    mode_groups.push_back(found - modes.begin());
+    if (found == modes.end())
+      modes.push_back(mode);
+  }
+
+  // Warm up the locales and any lazily created state
+  {
+    std::vector<sample_t> samples;
+    size_t errors = 0;
+    options_t warm_up = options;
+    warm_up.iterations = 1;
+    Run(warm_up, corpus, mode_groups, samples, errors);
+  }
+
+  std::vector<std::vector<sample_t> > samples(options.threads);
+  std::vector<size_t> errors(options.threads, 0);
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < options.threads; ++t) {
+    threads.emplace_back(Run, std::cref(options), std::cref(corpus),
+                         std::cref(mode_groups), std::ref(samples[t]),
+                         std::ref(errors[t]));
+  }
+  for (auto& thread : threads)
+    thread.join();
+  double seconds = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - start).count();
+
+  // Gather the samples of every thread by locale and travel mode
+  std::vector<group_t> groups(options.locales.size() * modes.size());
+  size_t legs = 0;
+  size_t error_count = 0;
+  for (size_t t = 0; t < options.threads; ++t) {
+    error_count += errors[t];
+    for (const auto& sample : samples[t]) {
+      auto& group = groups[sample.group];
+      for (size_t s = 0; s < StageTimes::kStageCount; ++s) {
+        group.stage_nanoseconds[s].push_back(sample.stage_times.Get(
+            static_cast<StageTimes::Stage>(s)));
+      }
+      group.total_nanoseconds.push_back(sample.stage_times.GetTotal());
+      group.allocations += sample.allocations;
+      ++legs;
+    }
+  }
+
+  std::cout << boost::format("%1% trip paths, %2% threads, %3% legs in %4$.3f s"
+      " (%5$.1f legs/s), %6% errors") % corpus.size() % options.threads % legs
+      % seconds % (legs / seconds) % error_count << std::endl;
+  for (size_t l = 0; l < options.locales.size(); ++l) {
+    for (size_t m = 0; m < modes.size(); ++m) {
+      auto& group = groups[l * modes.size() + m];
+      if (!group.total_nanoseconds.empty())
+        Report(options.locales[l] + " " + modes[m], group);
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
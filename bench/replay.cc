@@ -0,0 +1,267 @@
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <list>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <stdexcept>
+
+#include <boost/format.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <prime_server/http_protocol.hpp>
+
+#include "odin/job_capture.h"
+#include "odin/logger.h"
+#include "odin/service.h"
+
+using namespace valhalla::odin;
+
+namespace {
+
+constexpr auto kUsage =
+    "usage: odin_replay <capture_file>... [--config file] [--threads N]"
+    " [--rate jobs_per_second | --paced] [--repeat N] [--record file]"
+    " [--compare file]\n"
+    "\n"
+    "Replays the jobs of odin_capture files against in process odin workers,\n"
+    "flat out unless a rate is given or --paced keeps the captured timing.\n"
+    "--record writes a hash of every output message, --compare reports the\n"
+    "jobs whose output differs from such a recording, e.g. of another build.";
+
+using replay_clock_t = std::chrono::steady_clock;
+
+struct options_t {
+  std::vector<std::string> files;
+  boost::property_tree::ptree config;
+  size_t threads = 1;
+  double rate = 0;
+  bool paced = false;
+  size_t repeat = 1;
+  std::string record;
+  std::string compare;
+};
+
+options_t ParseOptions(int argc, char** argv) {
+  options_t options;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg.compare(0, 2, "--") != 0) {
+      options.files.push_back(arg);
+      continue;
+    }
+    if (arg == "--paced") {
+      options.paced = true;
+      continue;
+    }
+    if (i + 1 >= argc)
+      throw std::runtime_error(kUsage);
+    std::string value = argv[++i];
+    if (arg == "--config") {
+      boost::property_tree::read_json(value, options.config);
+    } else if (arg == "--threads") {
+      options.threads = std::max(std::stoul(value), 1ul);
+    } else if (arg == "--rate") {
+      options.rate = std::stod(value);
+    } else if (arg == "--repeat") {
+      options.repeat = std::max(std::stoul(value), 1ul);
+    } else if (arg == "--record") {
+      options.record = value;
+    } else if (arg == "--compare") {
+      options.compare = value;
+    } else {
+      throw std::runtime_error(kUsage);
+    }
+  }
+  if (options.files.empty() || (options.paced && (options.rate > 0)))
+    throw std::runtime_error(kUsage);
+  // A line per request would drown the report
+  if (!options.config.get_optional<std::string>("odin.logging.level"))
+    options.config.put("odin.logging.level", "warn");
+  return options;
+}
+
+// FNV-1a so recordings of different builds and platforms are comparable
+uint64_t Hash(const std::string& bytes) {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (unsigned char c : bytes) {
+    hash = (hash ^ c) * 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+// The outcome of replaying a job once
+struct outcome_t {
+  uint64_t latency;
+  bool error;
+  std::vector<uint64_t> hashes;
+};
+
+std::vector<std::vector<uint64_t>> ReadRecording(const std::string& file_name) {
+  std::ifstream file(file_name);
+  if (!file)
+    throw std::runtime_error("Cannot read " + file_name);
+  std::vector<std::vector<uint64_t>> recording;
+  std::string line;
+  while (std::getline(file, line)) {
+    std::istringstream stream(line);
+    std::vector<uint64_t> hashes;
+    uint64_t hash;
+    while (stream >> std::hex >> hash)
+      hashes.push_back(hash);
+    recording.emplace_back(std::move(hashes));
+  }
+  return recording;
+}
+
+uint64_t Percentile(std::vector<uint64_t>& values, double percentile) {
+  if (values.empty())
+    return 0;
+  size_t index = static_cast<size_t>(percentile * (values.size() - 1) + 0.5);
+  std::nth_element(values.begin(), values.begin() + index, values.end());
+  return values[index];
+}
+
+}
+
+int main(int argc, char** argv) {
+  options_t options;
+  std::vector<CapturedJob> jobs;
+  try {
+    options = ParseOptions(argc, argv);
+    for (const auto& file : options.files) {
+      auto file_jobs = JobCapture::Read(file);
+      jobs.insert(jobs.end(), file_jobs.begin(), file_jobs.end());
+    }
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (jobs.empty()) {
+    std::cerr << "No jobs to replay" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The captures of several workers interleave by time
+  std::stable_sort(jobs.begin(), jobs.end(),
+      [](const CapturedJob& a, const CapturedJob& b) {
+        return a.timestamp < b.timestamp;
+      });
+
+  // Process wide as in run_service
+  Logger::Configure(options.config);
+
+  // When each job is due relative to the start of the replay
+  size_t count = jobs.size() * options.repeat;
+  std::vector<uint64_t> due(count, 0);
+  uint64_t capture_duration = jobs.back().timestamp - jobs.front().timestamp;
+  for (size_t i = 0; i < count; ++i) {
+    if (options.rate > 0) {
+      due[i] = static_cast<uint64_t>(i * 1e9 / options.rate);
+    } else if (options.paced) {
+      due[i] = (i / jobs.size()) * capture_duration
+          + (jobs[i % jobs.size()].timestamp - jobs.front().timestamp);
+    }
+  }
+
+  // Each thread is a worker of its own taking the next due job
+  std::vector<outcome_t> outcomes(count);
+  std::atomic<size_t> next(0);
+  auto start = replay_clock_t::now();
+  auto replay = [&]() {
+    odin_worker_t worker(options.config);
+    size_t i;
+    while ((i = next.fetch_add(1)) < count) {
+      const auto& job = jobs[i % jobs.size()];
+      std::list<zmq::message_t> frames;
+      for (const auto& frame : job.frames)
+        frames.emplace_back(frame.data(), frame.size());
+      prime_server::http_request_t::info_t info{};
+      info.id = i;
+
+      // Latency counts from when the job was due so falling behind shows
+      auto scheduled = start + std::chrono::nanoseconds(due[i]);
+      std::this_thread::sleep_until(scheduled);
+      if (!(options.rate > 0) && !options.paced)
+        scheduled = replay_clock_t::now();
+      auto result = worker.work(frames, &info);
+      worker.cleanup();
+
+      auto& outcome = outcomes[i];
+      outcome.latency = std::chrono::duration_cast<std::chrono::nanoseconds>(
+          replay_clock_t::now() - scheduled).count();
+      outcome.error = !result.intermediate;
+      for (const auto& message : result.messages)
+        outcome.hashes.push_back(Hash(message));
+    }
+  };
+  std::vector<std::thread> threads;
+  for (size_t t = 1; t < options.threads; ++t)
+    threads.emplace_back(replay);
+  replay();
+  for (auto& thread : threads)
+    thread.join();
+  double seconds = std::chrono::duration<double>(replay_clock_t::now() - start).count();
+
+  // Throughput and latency
+  std::vector<uint64_t> latencies;
+  size_t errors = 0, legs = 0;
+  for (size_t i = 0; i < count; ++i) {
+    latencies.push_back(outcomes[i].latency);
+    errors += outcomes[i].error;
+    legs += jobs[i % jobs.size()].frames.size() - 1;
+  }
+  std::cout << boost::format("%1% jobs, %2% legs, %3% errors in %4$.2f s: "
+      "%5$.1f jobs/s, %6$.1f legs/s") % count % legs % errors % seconds
+      % (count / seconds) % (legs / seconds) << std::endl;
+  std::cout << boost::format("latency (ms) p50 %1$.2f p90 %2$.2f p99 %3$.2f max %4$.2f")
+      % (Percentile(latencies, 0.5) / 1e6) % (Percentile(latencies, 0.9) / 1e6)
+      % (Percentile(latencies, 0.99) / 1e6) % (Percentile(latencies, 1.0) / 1e6)
+      << std::endl;
+
+  // Outputs of the first pass over the jobs
+  if (!options.record.empty()) {
+    std::ofstream file(options.record);
+    for (size_t i = 0; i < jobs.size(); ++i) {
+      for (size_t m = 0; m < outcomes[i].hashes.size(); ++m)
+        file << (m ? " " : "") << std::hex << outcomes[i].hashes[m];
+      file << '\n';
+    }
+  }
+
+  if (!options.compare.empty()) {
+    std::vector<std::vector<uint64_t>> recording;
+    try {
+      recording = ReadRecording(options.compare);
+    } catch (const std::exception& e) {
+      std::cerr << e.what() << std::endl;
+      return EXIT_FAILURE;
+    }
+    size_t differences = 0;
+    for (size_t i = 0; i < jobs.size(); ++i) {
+      const auto& hashes = outcomes[i].hashes;
+      if ((i < recording.size()) && (recording[i] == hashes))
+        continue;
+      if (++differences <= 10) {
+        // The request itself is the first message, the legs follow
+        size_t message = 0;
+        while ((i < recording.size()) && (message < hashes.size())
+            && (message < recording[i].size())
+            && (recording[i][message] == hashes[message]))
+          ++message;
+        std::cout << "job " << i << " differs from message " << message
+                  << std::endl;
+      }
+    }
+    std::cout << differences << " of " << jobs.size()
+              << " jobs differ from " << options.compare << std::endl;
+    return differences ? EXIT_FAILURE : EXIT_SUCCESS;
+  }
+  return EXIT_SUCCESS;
+}
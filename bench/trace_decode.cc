@@ -0,0 +1,38 @@
+#include <cstdlib>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "odin/trace_buffer.h"
+
+using namespace valhalla::odin;
+
+// Prints the events of the binary traces written by the odin workers
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    std::cerr << "usage: odin_trace_decode <trace_file> [<trace_file> ...]"
+        << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  for (int i = 1; i < argc; ++i) {
+    std::ifstream file(argv[i], std::ios::binary);
+    std::stringstream bytes;
+    bytes << file.rdbuf();
+    try {
+      auto events = TraceBuffer::Deserialize(bytes.str());
+      std::cout << "# " << argv[i] << ": " << events.size() << " events"
+          << std::endl;
+      for (const auto& event : events) {
+        std::cout << TraceBuffer::ToString(event) << std::endl;
+      }
+    } catch (const std::exception& e) {
+      std::cerr << argv[i] << ": " << e.what() << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,467 @@
+#include <cstdint>
+#include <cstdlib>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <random>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include <sys/stat.h>
+
+#include <boost/format.hpp>
+
+#include <valhalla/midgard/pointll.h>
+#include <valhalla/midgard/encoded.h>
+
+#include "proto/trippath.pb.h"
+
+using namespace valhalla::midgard;
+using namespace valhalla::odin;
+
+namespace {
+
+constexpr auto kUsage =
+    "usage: odin_trip_path_generator <output_directory> [--count N]"
+    " [--nodes N] [--seed N] [--mode drive|pedestrian|bicycle]"
+    " [--intersecting-edges MEAN] [--name-churn P] [--signs P]"
+    " [--roundabouts P] [--ferries P] [--turn-channels P] [--transit P]"
+    " [--admin-changes N]";
+
+constexpr uint32_t kMinNodeCount = 2;
+constexpr uint32_t kMaxNodeCount = 10000000;
+
+// Rough kilometers per degree of latitude
+constexpr double kKmPerDegree = 111.2;
+constexpr double kRadPerDegree = 3.14159265358979 / 180.0;
+
+// Parameters of the generated trip paths. The probabilities are the chance
+// that a feature starts at any node of the path.
+struct options_t {
+  std::string directory;
+  uint32_t count = 1;
+  uint32_t node_count = 100;
+  uint32_t seed = 1;
+  TripPath_TravelMode travel_mode = TripPath_TravelMode_kDrive;
+  double intersecting_edges = 2.0;
+  double name_churn = 0.1;
+  double signs = 0.02;
+  double roundabouts = 0.01;
+  double ferries = 0.002;
+  double turn_channels = 0.01;
+  double transit = 0.0;
+  uint32_t admin_changes = 0;
+};
+
+const std::vector<std::pair<std::string, std::string> > kAdmins = {
+  { "US", "PA" }, { "US", "NJ" }, { "US", "NY" }, { "CA", "QC" },
+  { "DE", "BY" }, { "FR", "" }, { "IT", "" }, { "GB", "" }
+};
+
+const std::vector<std::string> kNameWords = {
+  "Main", "Elm", "Oak", "Maple", "Market", "Walnut", "Chestnut", "Spruce",
+  "Pine", "Cedar", "Lincoln", "Washington", "Jefferson", "Madison", "Park",
+  "Lake", "Hill", "River", "Church", "Mill", "Spring", "Ridge", "Valley"
+};
+
+const std::vector<std::string> kNameSuffixes = {
+  "Street", "Avenue", "Road", "Boulevard", "Lane", "Drive", "Pike", "Way"
+};
+
+const std::vector<std::string> kTowns = {
+  "Philadelphia", "Trenton", "Lancaster", "Harrisburg", "Reading",
+  "Allentown", "Camden", "Wilmington", "Baltimore", "New York"
+};
+
+class generator_t {
+ public:
+  generator_t(const options_t& options, uint32_t trip_id)
+      : options_(options),
+        rng_(options.seed + trip_id),
+        position_(-76.3f + Uniform() * 0.5f, 40.0f + Uniform() * 0.5f),
+        heading_(Uniform(0, 359)),
+        elapsed_time_(0),
+        admin_index_(0),
+        stop_count_(0) {
+    trip_path_.set_trip_id(trip_id);
+    trip_path_.set_leg_id(0);
+    trip_path_.set_leg_count(1);
+    for (uint32_t i = 0; i <= options_.admin_changes; ++i) {
+      const auto& admin = kAdmins[i % kAdmins.size()];
+      auto* trip_admin = trip_path_.add_admin();
+      trip_admin->set_country_code(admin.first);
+      trip_admin->set_state_code(admin.second);
+    }
+    NewName();
+  }
+
+  TripPath Generate() {
+    AddLocation();
+    shape_.push_back(position_);
+    uint32_t edge_count = options_.node_count - 1;
+    while (EdgeCount() < edge_count) {
+      uint32_t remaining = edge_count - EdgeCount();
+      double feature = Uniform();
+      if ((feature -= options_.roundabouts) < 0 && remaining >= 4) {
+        AddRoundabout(std::min(remaining - 1, Uniform(2, 4)));
+      } else if ((feature -= options_.ferries) < 0) {
+        AddFerry();
+      } else if ((feature -= options_.turn_channels) < 0 && remaining >= 2) {
+        AddTurnChannel();
+      } else if ((feature -= options_.signs) < 0 && remaining >= 3) {
+        AddExit();
+      } else if ((feature -= options_.transit) < 0 && remaining >= 4) {
+        AddTransit(std::min(remaining - 2, Uniform(2, 12)));
+      } else {
+        AddRoad();
+      }
+    }
+
+    // The destination node has no edge
+    AddNode();
+    AddLocation();
+    trip_path_.set_shape(encode<std::vector<PointLL> >(shape_));
+    return std::move(trip_path_);
+  }
+
+ protected:
+  double Uniform() {
+    return std::uniform_real_distribution<double>(0.0, 1.0)(rng_);
+  }
+
+  uint32_t Uniform(uint32_t min, uint32_t max) {
+    return std::uniform_int_distribution<uint32_t>(min, max)(rng_);
+  }
+
+  uint32_t EdgeCount() const {
+    return trip_path_.node_size();
+  }
+
+  uint32_t Turn(int degrees) const {
+    return (heading_ + 360 + (degrees % 360)) % 360;
+  }
+
+  void NewName() {
+    names_.clear();
+    names_.push_back(kNameWords[Uniform(0, kNameWords.size() - 1)] + " "
+        + kNameSuffixes[Uniform(0, kNameSuffixes.size() - 1)]);
+    if (Uniform() < 0.2)
+      names_.push_back("PA " + std::to_string(Uniform(1, 999)));
+  }
+
+  void AddLocation() {
+    auto* location = trip_path_.add_location();
+    location->mutable_ll()->set_lat(position_.lat());
+    location->mutable_ll()->set_lng(position_.lng());
+    location->set_type(TripPath_Location_Type_kBreak);
+    if (options_.transit > 0)
+      location->set_date_time("2016-04-01T08:00");
+  }
+
+  // Adds a node at the current position with its intersecting edges
+  TripPath_Node* AddNode(uint32_t xedge_count) {
+    // Spread the admin changes evenly along the path
+    if (options_.admin_changes > 0) {
+      admin_index_ = static_cast<uint64_t>(trip_path_.node_size())
+          * (options_.admin_changes + 1) / options_.node_count;
+    }
+
+    auto* node = trip_path_.add_node();
+    node->set_elapsed_time(elapsed_time_);
+    node->set_admin_index(admin_index_);
+    for (uint32_t i = 0; i < xedge_count; ++i) {
+      auto* xedge = node->add_intersecting_edge();
+      xedge->set_begin_heading(Turn(Uniform(30, 330)));
+      xedge->set_prev_name_consistency(Uniform() < 0.05);
+      xedge->set_curr_name_consistency(Uniform() < 0.05);
+      auto traversability = (Uniform() < 0.8) ? TripPath_Traversability_kBoth
+          : TripPath_Traversability_kForward;
+      xedge->set_driveability(traversability);
+      xedge->set_cyclability(traversability);
+      xedge->set_walkability(TripPath_Traversability_kBoth);
+    }
+    return node;
+  }
+
+  TripPath_Node* AddNode() {
+    return AddNode(std::poisson_distribution<uint32_t>(
+        options_.intersecting_edges)(rng_));
+  }
+
+  // Adds the edge of the node from the current position in the current
+  // heading and moves to its end
+  TripPath_Edge* AddEdge(TripPath_Node* node, float length, float speed,
+                         TripPath_RoadClass road_class,
+                         TripPath_Use use = TripPath_Use_kRoadUse) {
+    auto* edge = node->mutable_edge();
+    for (const auto& name : names_)
+      edge->add_name(name);
+    edge->set_length(length);
+    edge->set_speed(speed);
+    edge->set_road_class(road_class);
+    edge->set_begin_heading(heading_);
+    edge->set_end_heading(heading_);
+    edge->set_traversability(TripPath_Traversability_kBoth);
+    edge->set_use(use);
+    edge->set_drive_on_right(true);
+    edge->set_travel_mode(options_.travel_mode);
+    edge->set_end_node_index(trip_path_.node_size());
+    edge->set_begin_shape_index(shape_.size() - 1);
+
+    // Move along the heading
+    double radians = heading_ * kRadPerDegree;
+    double lat = position_.lat() + length * std::cos(radians) / kKmPerDegree;
+    double lng = position_.lng() + length * std::sin(radians)
+        / (kKmPerDegree * std::cos(lat * kRadPerDegree));
+    position_ = PointLL(lng, lat);
+    shape_.push_back(position_);
+    edge->set_end_shape_index(shape_.size() - 1);
+
+    elapsed_time_ += static_cast<uint32_t>(length / speed * 3600.0f) + 1;
+    return edge;
+  }
+
+  void AddRoad() {
+    // Mostly straight with some turns
+    double turn = Uniform();
+    if (turn < 0.08)
+      heading_ = Turn((Uniform() < 0.5) ? -90 : 90);
+    else if (turn < 0.12)
+      heading_ = Turn((Uniform() < 0.5) ? -35 : 35);
+    else if (turn < 0.14)
+      heading_ = Turn((Uniform() < 0.5) ? -150 : 150);
+    else
+      heading_ = Turn(static_cast<int>(Uniform(0, 20)) - 10);
+
+    if (Uniform() < options_.name_churn)
+      NewName();
+
+    auto road_class = static_cast<TripPath_RoadClass>(Uniform(2, 6));
+    AddEdge(AddNode(), 0.05f + Uniform() * 0.5f, 25.0f + Uniform() * 40.0f,
+            road_class);
+  }
+
+  void AddRoundabout(uint32_t roundabout_edge_count) {
+    // Enter to the right and go counter clockwise
+    heading_ = Turn(45);
+    for (uint32_t i = 0; i < roundabout_edge_count; ++i) {
+      auto* edge = AddEdge(AddNode(1), 0.03f, 20.0f,
+                           TripPath_RoadClass_kTertiary);
+      edge->set_roundabout(true);
+      edge->set_traversability(TripPath_Traversability_kForward);
+      heading_ = Turn(-60);
+    }
+
+    NewName();
+    heading_ = Turn(45);
+    AddEdge(AddNode(1), 0.2f + Uniform() * 0.5f, 40.0f,
+            TripPath_RoadClass_kSecondary);
+  }
+
+  void AddFerry() {
+    names_ = { kTowns[Uniform(0, kTowns.size() - 1)] + " Ferry" };
+    AddEdge(AddNode(0), 2.0f + Uniform() * 10.0f, 20.0f,
+            TripPath_RoadClass_kServiceOther, TripPath_Use_kFerryUse);
+    NewName();
+  }
+
+  void AddTurnChannel() {
+    // Cut the corner of a right turn
+    int direction = (Uniform() < 0.5) ? -1 : 1;
+    heading_ = Turn(45 * direction);
+    names_.clear();
+    AddEdge(AddNode(1), 0.05f, 25.0f, TripPath_RoadClass_kSecondary,
+            TripPath_Use_kTurnChannelUse);
+
+    NewName();
+    heading_ = Turn(45 * direction);
+    AddEdge(AddNode(), 0.1f + Uniform() * 0.5f, 40.0f,
+            TripPath_RoadClass_kSecondary);
+  }
+
+  void AddExit() {
+    // Drive the motorway to a signed exit ramp
+    names_ = { "I " + std::to_string(Uniform(1, 99)) };
+    AddEdge(AddNode(1), 1.0f + Uniform() * 5.0f, 105.0f,
+            TripPath_RoadClass_kMotorway);
+
+    auto* junction = AddNode(1);
+    junction->set_type(TripPath_Node_Type_kMotorwayJunction);
+    heading_ = Turn(20);
+    names_.clear();
+    auto* ramp = AddEdge(junction, 0.4f, 60.0f, TripPath_RoadClass_kMotorway,
+                         TripPath_Use_kRampUse);
+    auto* sign = ramp->mutable_sign();
+    sign->add_exit_number(std::to_string(Uniform(1, 350))
+        + ((Uniform() < 0.3) ? "B" : ""));
+    sign->add_exit_branch("US " + std::to_string(Uniform(1, 422)) + " North");
+    sign->add_exit_toward(kTowns[Uniform(0, kTowns.size() - 1)]);
+    if (Uniform() < 0.3)
+      sign->add_exit_toward(kTowns[Uniform(0, kTowns.size() - 1)]);
+
+    NewName();
+    heading_ = Turn(70);
+    AddEdge(AddNode(), 0.2f + Uniform() * 0.5f, 50.0f,
+            TripPath_RoadClass_kPrimary);
+  }
+
+  void SetTransitStop(TripPath_Node* node, bool arrival, bool departure) {
+    node->set_type(TripPath_Node_Type_kMultiUseTransitStop);
+    auto* stop = node->mutable_transit_stop_info();
+    stop->set_type(TripPath_TransitStopInfo_Type_kStop);
+    stop->set_onestop_id("s-dr4-stop" + std::to_string(stop_count_));
+    stop->set_name(kNameWords[stop_count_ % kNameWords.size()] + " Station");
+    uint32_t minutes = 8 * 60 + elapsed_time_ / 60;
+    std::string time = (boost::format("2016-04-01T%02d:%02d")
+        % ((minutes / 60) % 24) % (minutes % 60)).str();
+    if (arrival)
+      stop->set_arrival_date_time(time);
+    if (departure)
+      stop->set_departure_date_time(time);
+    stop->mutable_ll()->set_lat(position_.lat());
+    stop->mutable_ll()->set_lng(position_.lng());
+    ++stop_count_;
+  }
+
+  void AddTransit(uint32_t transit_edge_count) {
+    // Walk to the first stop
+    names_.clear();
+    auto* connection = AddEdge(AddNode(0), 0.05f, 5.0f,
+                               TripPath_RoadClass_kServiceOther,
+                               TripPath_Use_kTransitConnectionUse);
+    connection->set_travel_mode(TripPath_TravelMode_kPedestrian);
+
+    bool rail = (Uniform() < 0.5);
+    TripPath_TransitRouteInfo route;
+    route.set_onestop_id("r-dr4-route" + std::to_string(Uniform(1, 99)));
+    route.set_block_id(Uniform(1, 9999));
+    route.set_trip_id(Uniform(1, 99999));
+    route.set_short_name(std::to_string(Uniform(1, 99)));
+    route.set_long_name(kTowns[Uniform(0, kTowns.size() - 1)] + " Line");
+    route.set_headsign(kTowns[Uniform(0, kTowns.size() - 1)]);
+    route.set_color(0x2a5ea5);
+    route.set_text_color(0xffffff);
+    route.set_operator_onestop_id("o-dr4-operator");
+    route.set_operator_name("Regional Transit");
+
+    for (uint32_t i = 0; i < transit_edge_count; ++i) {
+      auto* node = AddNode(0);
+      SetTransitStop(node, i > 0, true);
+      heading_ = Turn(static_cast<int>(Uniform(0, 30)) - 15);
+      auto* edge = AddEdge(node, 0.5f + Uniform() * 2.0f, 40.0f,
+                           TripPath_RoadClass_kServiceOther,
+                           rail ? TripPath_Use_kRailUse : TripPath_Use_kBusUse);
+      edge->set_travel_mode(TripPath_TravelMode_kTransit);
+      edge->set_transit_type(rail ? TripPath_TransitType_kRail
+          : TripPath_TransitType_kBus);
+      *edge->mutable_transit_route_info() = route;
+    }
+
+    // Walk away from the last stop
+    auto* node = AddNode(0);
+    SetTransitStop(node, true, false);
+    connection = AddEdge(node, 0.05f, 5.0f, TripPath_RoadClass_kServiceOther,
+                         TripPath_Use_kTransitConnectionUse);
+    connection->set_travel_mode(TripPath_TravelMode_kPedestrian);
+    NewName();
+  }
+
+  const options_t& options_;
+  std::mt19937 rng_;
+  TripPath trip_path_;
+  std::vector<PointLL> shape_;
+  PointLL position_;
+  uint32_t heading_;
+  uint32_t elapsed_time_;
+  uint32_t admin_index_;
+  uint32_t stop_count_;
+  std::vector<std::string> names_;
+};
+
+options_t ParseOptions(int argc, char** argv) {
+  options_t options;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg.compare(0, 2, "--") != 0) {
+      options.directory = arg;
+      continue;
+    }
+    if (i + 1 >= argc)
+      throw std::runtime_error(kUsage);
+    std::string value = argv[++i];
+    if (arg == "--count") {
+      options.count = std::stoul(value);
+    } else if (arg == "--nodes") {
+      options.node_count = std::stoul(value);
+    } else if (arg == "--seed") {
+      options.seed = std::stoul(value);
+    } else if (arg == "--mode") {
+      if (value == "drive")
+        options.travel_mode = TripPath_TravelMode_kDrive;
+      else if (value == "pedestrian")
+        options.travel_mode = TripPath_TravelMode_kPedestrian;
+      else if (value == "bicycle")
+        options.travel_mode = TripPath_TravelMode_kBicycle;
+      else
+        throw std::runtime_error(kUsage);
+    } else if (arg == "--intersecting-edges") {
+      options.intersecting_edges = std::stod(value);
+    } else if (arg == "--name-churn") {
+      options.name_churn = std::stod(value);
+    } else if (arg == "--signs") {
+      options.signs = std::stod(value);
+    } else if (arg == "--roundabouts") {
+      options.roundabouts = std::stod(value);
+    } else if (arg == "--ferries") {
+      options.ferries = std::stod(value);
+    } else if (arg == "--turn-channels") {
+      options.turn_channels = std::stod(value);
+    } else if (arg == "--transit") {
+      options.transit = std::stod(value);
+    } else if (arg == "--admin-changes") {
+      options.admin_changes = std::stoul(value);
+    } else {
+      throw std::runtime_error(kUsage);
+    }
+  }
+  if (options.directory.empty())
+    throw std::runtime_error(kUsage);
+  if ((options.node_count < kMinNodeCount) || (options.node_count > kMaxNodeCount))
+    throw std::runtime_error("Node count must be between "
+        + std::to_string(kMinNodeCount) + " and " + std::to_string(kMaxNodeCount));
+  if ((options.transit > 0)
+      && (options.travel_mode != TripPath_TravelMode_kPedestrian))
+    throw std::runtime_error("Transit segments require the pedestrian mode");
+  return options;
+}
+
+}
+
+int main(int argc, char** argv) {
+  options_t options;
+  try {
+    options = ParseOptions(argc, argv);
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  mkdir(options.directory.c_str(), 0755);
+  for (uint32_t trip_id = 0; trip_id < options.count; ++trip_id) {
+    generator_t generator(options, trip_id);
+    TripPath trip_path = generator.Generate();
+
+    std::string file_name = (boost::format("%1%/trip_path_%2$06d.pb")
+        % options.directory % trip_id).str();
+    std::ofstream file(file_name, std::ios::binary);
+    if (!file || !trip_path.SerializeToOstream(&file)) {
+      std::cerr << "Cannot write " << file_name << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  std::cout << options.count << " trip paths of " << options.node_count
+      << " nodes written to " << options.directory << std::endl;
+  return EXIT_SUCCESS;
+}
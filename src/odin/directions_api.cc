@@ -0,0 +1,143 @@
+#include <sstream>
+
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <valhalla/baldr/errorcode_util.h>
+
+#include "proto/trippath.pb.h"
+#include "odin/directions_api.h"
+#include "odin/directions_api_c.h"
+#include "odin/directionsbuilder.h"
+#include "odin/util.h"
+
+using namespace valhalla;
+using namespace valhalla::odin;
+
+namespace {
+
+TripDirections Build(const uint8_t* trip_path, size_t size,
+                     const DirectionsOptions& options) {
+  // Unsupported languages get the default language like the service does
+  const auto& locales = get_locales();
+  if (locales.find(options.language()) == locales.end()) {
+    DirectionsOptions default_language_options(options);
+    default_language_options.set_language(
+        DirectionsOptions::default_instance().language());
+    return Build(trip_path, size, default_language_options);
+  }
+
+  // Crack open the path
+  TripPath path;
+  bool parsed = false;
+  try {
+    parsed = path.ParseFromArray(trip_path, static_cast<int>(size));
+  } catch (...) {
+  }
+  if (!parsed) {
+    throw valhalla_exception_t{500, 201};
+  }
+
+  DirectionsBuilder directions;
+  try {
+    return directions.Build(options, path);
+  } catch (const valhalla_exception_t&) {
+    throw;
+  } catch (...) {
+    throw valhalla_exception_t{500, 202};
+  }
+}
+
+thread_local std::string error_message;
+
+}
+
+struct odin_output_buffer {
+  OutputBuffer buffer;
+};
+
+namespace valhalla {
+namespace odin {
+
+const uint8_t* OutputBuffer::data() const {
+  return reinterpret_cast<const uint8_t*>(bytes_.data());
+}
+
+size_t OutputBuffer::size() const {
+  return bytes_.size();
+}
+
+void OutputBuffer::clear() {
+  bytes_.clear();
+}
+
+std::string& OutputBuffer::bytes() {
+  return bytes_;
+}
+
+void BuildDirections(const uint8_t* trip_path, size_t size,
+                     const DirectionsOptions& options, OutputBuffer& output) {
+  output.clear();
+  Build(trip_path, size, options).SerializeToString(&output.bytes());
+}
+
+TripDirections BuildDirections(const uint8_t* trip_path, size_t size,
+                               const DirectionsOptions& options) {
+  return Build(trip_path, size, options);
+}
+
+}
+}
+
+extern "C" {
+
+odin_output_buffer* odin_output_buffer_new(void) {
+  return new odin_output_buffer();
+}
+
+void odin_output_buffer_free(odin_output_buffer* output) {
+  delete output;
+}
+
+const uint8_t* odin_output_buffer_data(const odin_output_buffer* output) {
+  return output->buffer.data();
+}
+
+size_t odin_output_buffer_size(const odin_output_buffer* output) {
+  return output->buffer.size();
+}
+
+int odin_build_directions(const uint8_t* trip_path, size_t trip_path_size,
+                          const char* options_json,
+                          odin_output_buffer* output) {
+  // Nothing may escape into the C caller
+  try {
+    DirectionsOptions options;
+    if (options_json) {
+      boost::property_tree::ptree pt;
+      try {
+        std::istringstream stream(options_json);
+        boost::property_tree::read_json(stream, pt);
+      } catch (const std::exception& e) {
+        throw valhalla_exception_t{400, 299, std::string(e.what())};
+      }
+      options = GetDirectionsOptions(pt);
+    }
+    BuildDirections(trip_path, trip_path_size, options, output->buffer);
+    return 0;
+  } catch (const valhalla_exception_t& e) {
+    error_message = e.error_code_message;
+    return static_cast<int>(e.error_code);
+  } catch (const std::exception& e) {
+    error_message = e.what();
+    return 202;
+  } catch (...) {
+    error_message = "Unknown failure";
+    return 202;
+  }
+}
+
+const char* odin_error_message(void) {
+  return error_message.c_str();
+}
+
+}
@@ -0,0 +1,197 @@
+#include <algorithm>
+#include <chrono>
+
+#include "proto/trippath.pb.h"
+#include "proto/tripdirections.pb.h"
+#include "odin/directions_batch.h"
+#include "odin/directionsbuilder.h"
+
+namespace {
+
+uint64_t NanosecondsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - start).count();
+}
+
+}
+
+namespace valhalla {
+namespace odin {
+
+DirectionsBatch::DirectionsBatch(uint32_t thread_count)
+    : time_stages_(false),
+      generation_(0),
+      running_(0),
+      stop_(false),
+      next_(0) {
+  // The thread calling Build is one of the builders
+  for (uint32_t i = 1; i < thread_count; ++i) {
+    threads_.emplace_back(&DirectionsBatch::RunThread, this);
+  }
+}
+
+DirectionsBatch::~DirectionsBatch() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  started_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+size_t DirectionsBatch::AddOptions(const DirectionsOptions& options) {
+  auto inserted = options_indexes_.emplace(options.SerializeAsString(),
+                                           options_.size());
+  if (inserted.second) {
+    options_.push_back(options);
+  }
+  return inserted.first->second;
+}
+
+size_t DirectionsBatch::Add(size_t options_index, const char* trip_path,
+                            size_t size, TraceBuffer* trace) {
+  legs_.push_back({ options_index, trip_path, size, trace });
+  return legs_.size() - 1;
+}
+
+void DirectionsBatch::Build(bool time_stages) {
+  time_stages_ = time_stages;
+  if (results_.size() < legs_.size()) {
+    results_.resize(legs_.size());
+  }
+
+  // Build the legs of the same options back to back
+  order_.resize(legs_.size());
+  for (size_t i = 0; i < order_.size(); ++i) {
+    order_[i] = i;
+  }
+  if (options_.size() > 1) {
+    std::stable_sort(order_.begin(), order_.end(), [this](size_t a, size_t b) {
+      return legs_[a].options_index < legs_[b].options_index;
+    });
+  }
+
+  next_.store(0, std::memory_order_relaxed);
+  if (threads_.empty() || (legs_.size() < 2)) {
+    BuildNextLegs();
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++generation_;
+    running_ = threads_.size();
+  }
+  started_.notify_all();
+  BuildNextLegs();
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  finished_.wait(lock, [this]() { return running_ == 0; });
+}
+
+DirectionsBatch::Result& DirectionsBatch::GetResult(size_t leg) {
+  return results_[leg];
+}
+
+size_t DirectionsBatch::size() const {
+  return legs_.size();
+}
+
+size_t DirectionsBatch::options_count() const {
+  return options_.size();
+}
+
+uint32_t DirectionsBatch::thread_count() const {
+  return threads_.size() + 1;
+}
+
+void DirectionsBatch::clear() {
+  options_.clear();
+  options_indexes_.clear();
+  legs_.clear();
+}
+
+void DirectionsBatch::BuildLeg(size_t leg_index) {
+  const leg_t& leg = legs_[leg_index];
+  Result& result = results_[leg_index];
+  result.directions.clear();
+  result.translations.clear();
+  result.error_code = 0;
+  result.node_count = 0;
+  result.maneuver_count = 0;
+  result.parse_nanoseconds = 0;
+  result.serialize_nanoseconds = 0;
+  result.stage_times.Clear();
+
+  // Crack open the path
+  auto parse_start = std::chrono::steady_clock::now();
+  TripPath trip_path;
+  try {
+    trip_path.ParseFromArray(leg.trip_path, static_cast<int>(leg.size));
+  } catch (...) {
+    result.error_code = 201;
+    return;
+  }
+  result.parse_nanoseconds = NanosecondsSince(parse_start);
+
+  // Get some annotated directions, in every language asked for
+  const auto& options = options_[leg.options_index];
+  auto* stage_times = time_stages_ ? &result.stage_times : nullptr;
+  DirectionsBuilder directions;
+  std::vector<TripDirections> trip_directions;
+  try {
+    if (options.languages_size() == 0) {
+      trip_directions.emplace_back(
+          directions.Build(options, trip_path, stage_times, leg.trace));
+    } else {
+      trip_directions = directions.BuildLanguages(options, trip_path,
+                                                  stage_times, leg.trace);
+    }
+  } catch (...) {
+    result.error_code = 202;
+    return;
+  }
+
+  auto serialize_start = std::chrono::steady_clock::now();
+  trip_directions.front().SerializeToString(&result.directions);
+  result.translations.resize(trip_directions.size() - 1);
+  for (size_t i = 1; i < trip_directions.size(); ++i) {
+    trip_directions[i].SerializeToString(&result.translations[i - 1]);
+  }
+  result.serialize_nanoseconds = NanosecondsSince(serialize_start);
+  result.node_count = trip_path.node_size();
+  result.maneuver_count = trip_directions.front().maneuver_size();
+}
+
+void DirectionsBatch::BuildNextLegs() {
+  size_t next;
+  while ((next = next_.fetch_add(1, std::memory_order_relaxed)) < order_.size()) {
+    BuildLeg(order_[next]);
+  }
+}
+
+void DirectionsBatch::RunThread() {
+  uint64_t generation = 0;
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    started_.wait(lock, [this, generation]() {
+      return stop_ || (generation_ != generation);
+    });
+    if (stop_) {
+      return;
+    }
+    generation = generation_;
+
+    lock.unlock();
+    BuildNextLegs();
+    lock.lock();
+    if (--running_ == 0) {
+      finished_.notify_one();
+    }
+  }
+}
+
+}
+}
@@ -0,0 +1,143 @@
+#include <cstring>
+
+#include "odin/directions_cache.h"
+
+namespace {
+
+// Approximate bookkeeping cost of an entry on top of its key and value
+constexpr size_t kEntryOverhead = 128;
+
+size_t EntryBytes(const std::string& key, size_t trip_path_size,
+                  const std::string& directions) {
+  return key.size() + trip_path_size + directions.size() + kEntryOverhead;
+}
+
+}
+
+namespace valhalla {
+namespace odin {
+
+DirectionsCache::DirectionsCache(size_t max_bytes)
+    : max_bytes_(max_bytes),
+      bytes_(0),
+      hits_(0),
+      misses_(0),
+      evictions_(0) {
+}
+
+uint64_t DirectionsCache::HashBytes(const void* data, size_t size,
+                                    uint64_t seed) {
+  constexpr uint64_t kMultiplier = 0x9e3779b97f4a7c15ULL;
+  const char* bytes = static_cast<const char*>(data);
+  uint64_t hash = (seed ^ size) * kMultiplier;
+  uint64_t word;
+  while (size >= sizeof(word)) {
+    std::memcpy(&word, bytes, sizeof(word));
+    hash = (hash ^ word) * kMultiplier;
+    hash ^= hash >> 29;
+    bytes += sizeof(word);
+    size -= sizeof(word);
+  }
+  word = 0;
+  std::memcpy(&word, bytes, size);
+  hash = (hash ^ word) * kMultiplier;
+  hash ^= hash >> 32;
+  return hash;
+}
+
+std::string DirectionsCache::MakeKey(const void* trip_path, size_t size,
+                                     const std::string& directions_options) {
+  uint64_t hash = HashBytes(trip_path, size);
+  uint64_t length = size;
+  std::string key(sizeof(hash) + sizeof(length), '\0');
+  std::memcpy(&key[0], &hash, sizeof(hash));
+  std::memcpy(&key[sizeof(hash)], &length, sizeof(length));
+  key += directions_options;
+  return key;
+}
+
+const std::string* DirectionsCache::Find(const std::string& key,
+                                         const void* trip_path, size_t size) {
+  if (!enabled()) {
+    return nullptr;
+  }
+
+  // A hash can collide so the bytes are compared too
+  auto found = index_.find(key);
+  if ((found == index_.end())
+      || (found->second->trip_path.size() != size)
+      || (std::memcmp(found->second->trip_path.data(), trip_path, size) != 0)) {
+    ++misses_;
+    return nullptr;
+  }
+
+  ++hits_;
+  entries_.splice(entries_.begin(), entries_, found->second);
+  return &found->second->directions;
+}
+
+void DirectionsCache::Insert(const std::string& key, const void* trip_path,
+                             size_t size, const std::string& directions) {
+  // Nothing to do if the directions could never fit
+  size_t entry_bytes = EntryBytes(key, size, directions);
+  if (!enabled() || (entry_bytes > max_bytes_)) {
+    return;
+  }
+
+  // Replace directions that are already cached
+  auto found = index_.find(key);
+  if (found != index_.end()) {
+    const auto& entry = *found->second;
+    bytes_ -= EntryBytes(entry.key, entry.trip_path.size(), entry.directions);
+    entries_.erase(found->second);
+    index_.erase(found);
+  }
+
+  while ((bytes_ + entry_bytes) > max_bytes_) {
+    Evict();
+  }
+
+  entries_.push_front({ key, std::string(static_cast<const char*>(trip_path),
+                                         size), directions });
+  index_.emplace(key, entries_.begin());
+  bytes_ += entry_bytes;
+}
+
+void DirectionsCache::Evict() {
+  const auto& entry = entries_.back();
+  bytes_ -= EntryBytes(entry.key, entry.trip_path.size(), entry.directions);
+  index_.erase(entry.key);
+  entries_.pop_back();
+  ++evictions_;
+}
+
+bool DirectionsCache::enabled() const {
+  return (max_bytes_ > 0);
+}
+
+size_t DirectionsCache::max_bytes() const {
+  return max_bytes_;
+}
+
+size_t DirectionsCache::bytes() const {
+  return bytes_;
+}
+
+size_t DirectionsCache::size() const {
+  return entries_.size();
+}
+
+uint64_t DirectionsCache::hits() const {
+  return hits_;
+}
+
+uint64_t DirectionsCache::misses() const {
+  return misses_;
+}
+
+uint64_t DirectionsCache::evictions() const {
+  return evictions_;
+}
+
+}
+}
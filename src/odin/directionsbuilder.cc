@@ -1,10 +1,10 @@
 #include <iostream>
-#include <unordered_map>
 
 #include "proto/tripdirections.pb.h"
 #include "proto/directions_options.pb.h"
 #include "odin/enhancedtrippath.h"
 #include "odin/directionsbuilder.h"
+#include "odin/enum_table.h"
 #include "odin/maneuversbuilder.h"
 #include "odin/narrativebuilder.h"
 #include "odin/narrative_builder_factory.h"
@@ -14,48 +14,68 @@ namespace {
 // Minimum edge length (~10 feet)
 constexpr auto kMinEdgeLength = 0.003f;
 
+// Sets a string field of the trip directions, taking the string over when
+// the maneuvers are not used again
+void SetString(std::string& value, std::string* field, bool move_strings) {
+  if (move_strings) {
+    field->swap(value);
+  } else {
+    *field = value;
+  }
+}
+
 }
 
 namespace valhalla {
 namespace odin {
 
-const std::unordered_map<int, TripDirections_VehicleType> translate_vehicle_type {
-  { static_cast<int>(TripPath_VehicleType_kCar), TripDirections_VehicleType_kCar },
-  { static_cast<int>(TripPath_VehicleType_kMotorcycle), TripDirections_VehicleType_kMotorcycle },
-  { static_cast<int>(TripPath_VehicleType_kAutoBus), TripDirections_VehicleType_kAutoBus },
-  { static_cast<int>(TripPath_VehicleType_kTractorTrailer), TripDirections_VehicleType_kTractorTrailer },
-};
-
-const std::unordered_map<int, TripDirections_PedestrianType> translate_pedestrian_type {
-  { static_cast<int>(TripPath_PedestrianType_kFoot), TripDirections_PedestrianType_kFoot },
-  { static_cast<int>(TripPath_PedestrianType_kWheelchair), TripDirections_PedestrianType_kWheelchair },
-  { static_cast<int>(TripPath_PedestrianType_kSegway), TripDirections_PedestrianType_kSegway },
-};
-
-const std::unordered_map<int, TripDirections_BicycleType> translate_bicycle_type {
-  { static_cast<int>(TripPath_BicycleType_kRoad), TripDirections_BicycleType_kRoad },
-  { static_cast<int>(TripPath_BicycleType_kCross), TripDirections_BicycleType_kCross },
-  { static_cast<int>(TripPath_BicycleType_kHybrid), TripDirections_BicycleType_kHybrid },
-  { static_cast<int>(TripPath_BicycleType_kMountain), TripDirections_BicycleType_kMountain },
-};
-
-const std::unordered_map<int, TripDirections_TransitType> translate_transit_type {
-  { static_cast<int>(TripPath_TransitType_kTram), TripDirections_TransitType_kTram },
-  { static_cast<int>(TripPath_TransitType_kMetro), TripDirections_TransitType_kMetro },
-  { static_cast<int>(TripPath_TransitType_kRail), TripDirections_TransitType_kRail },
-  { static_cast<int>(TripPath_TransitType_kBus), TripDirections_TransitType_kBus },
-  { static_cast<int>(TripPath_TransitType_kFerry), TripDirections_TransitType_kFerry },
-  { static_cast<int>(TripPath_TransitType_kCableCar), TripDirections_TransitType_kCableCar },
-  { static_cast<int>(TripPath_TransitType_kGondola), TripDirections_TransitType_kGondola },
-  { static_cast<int>(TripPath_TransitType_kFunicular), TripDirections_TransitType_kFunicular },
-};
-
-const std::unordered_map<int, TripDirections_TravelMode> translate_travel_mode {
-  { static_cast<int>(TripPath_TravelMode_kDrive), TripDirections_TravelMode_kDrive },
-  { static_cast<int>(TripPath_TravelMode_kPedestrian), TripDirections_TravelMode_kPedestrian },
-  { static_cast<int>(TripPath_TravelMode_kBicycle), TripDirections_TravelMode_kBicycle },
-  { static_cast<int>(TripPath_TravelMode_kTransit), TripDirections_TravelMode_kTransit },
-};
+constexpr EnumTable<TripPath_VehicleType, TripDirections_VehicleType,
+                    TripPath_VehicleType_VehicleType_ARRAYSIZE> translate_vehicle_type {{
+  { TripPath_VehicleType_kCar, TripDirections_VehicleType_kCar },
+  { TripPath_VehicleType_kMotorcycle, TripDirections_VehicleType_kMotorcycle },
+  { TripPath_VehicleType_kAutoBus, TripDirections_VehicleType_kAutoBus },
+  { TripPath_VehicleType_kTractorTrailer, TripDirections_VehicleType_kTractorTrailer },
+}};
+static_assert(translate_vehicle_type.IsDense(), "Every TripPath_VehicleType must be translated in order");
+
+constexpr EnumTable<TripPath_PedestrianType, TripDirections_PedestrianType,
+                    TripPath_PedestrianType_PedestrianType_ARRAYSIZE> translate_pedestrian_type {{
+  { TripPath_PedestrianType_kFoot, TripDirections_PedestrianType_kFoot },
+  { TripPath_PedestrianType_kWheelchair, TripDirections_PedestrianType_kWheelchair },
+  { TripPath_PedestrianType_kSegway, TripDirections_PedestrianType_kSegway },
+}};
+static_assert(translate_pedestrian_type.IsDense(), "Every TripPath_PedestrianType must be translated in order");
+
+constexpr EnumTable<TripPath_BicycleType, TripDirections_BicycleType,
+                    TripPath_BicycleType_BicycleType_ARRAYSIZE> translate_bicycle_type {{
+  { TripPath_BicycleType_kRoad, TripDirections_BicycleType_kRoad },
+  { TripPath_BicycleType_kCross, TripDirections_BicycleType_kCross },
+  { TripPath_BicycleType_kHybrid, TripDirections_BicycleType_kHybrid },
+  { TripPath_BicycleType_kMountain, TripDirections_BicycleType_kMountain },
+}};
+static_assert(translate_bicycle_type.IsDense(), "Every TripPath_BicycleType must be translated in order");
+
+constexpr EnumTable<TripPath_TransitType, TripDirections_TransitType,
+                    TripPath_TransitType_TransitType_ARRAYSIZE> translate_transit_type {{
+  { TripPath_TransitType_kTram, TripDirections_TransitType_kTram },
+  { TripPath_TransitType_kMetro, TripDirections_TransitType_kMetro },
+  { TripPath_TransitType_kRail, TripDirections_TransitType_kRail },
+  { TripPath_TransitType_kBus, TripDirections_TransitType_kBus },
+  { TripPath_TransitType_kFerry, TripDirections_TransitType_kFerry },
+  { TripPath_TransitType_kCableCar, TripDirections_TransitType_kCableCar },
+  { TripPath_TransitType_kGondola, TripDirections_TransitType_kGondola },
+  { TripPath_TransitType_kFunicular, TripDirections_TransitType_kFunicular },
+}};
+static_assert(translate_transit_type.IsDense(), "Every TripPath_TransitType must be translated in order");
+
+constexpr EnumTable<TripPath_TravelMode, TripDirections_TravelMode,
+                    TripPath_TravelMode_TravelMode_ARRAYSIZE> translate_travel_mode {{
+  { TripPath_TravelMode_kDrive, TripDirections_TravelMode_kDrive },
+  { TripPath_TravelMode_kPedestrian, TripDirections_TravelMode_kPedestrian },
+  { TripPath_TravelMode_kBicycle, TripDirections_TravelMode_kBicycle },
+  { TripPath_TravelMode_kTransit, TripDirections_TravelMode_kTransit },
+}};
+static_assert(translate_travel_mode.IsDense(), "Every TripPath_TravelMode must be translated in order");
 
 DirectionsBuilder::DirectionsBuilder() {
 }
@@ -66,7 +86,8 @@ DirectionsBuilder::DirectionsBuilder() {
 // calls PopulateTripDirections to transform the maneuver list into the
 // trip directions.
 TripDirections DirectionsBuilder::Build(
-    const DirectionsOptions& directions_options, TripPath& trip_path) {
+    const DirectionsOptions& directions_options, TripPath& trip_path,
+    StageTimes* stage_times, TraceBuffer* trace) {
   // Validate trip path node list
   if (trip_path.node_size() < 1) {
     throw valhalla_exception_t{400, 210};
@@ -77,21 +98,83 @@ TripDirections DirectionsBuilder::Build(
   // Produce maneuvers and narrative if enabled
   std::list<Maneuver> maneuvers;
   if (directions_options.narrative()) {
-    // Update the heading of ~0 length edges
-    UpdateHeading(etp);
+    maneuvers = BuildManeuvers(directions_options, etp, stage_times, trace);
+    BuildNarrative(directions_options, etp, maneuvers, stage_times);
+  }
 
-    // Create maneuvers
-    ManeuversBuilder maneuversBuilder(directions_options, etp);
-    maneuvers = maneuversBuilder.Build();
+  // Return trip directions
+  ScopedStageTimer timer(stage_times, StageTimes::kPopulate);
+  return PopulateTripDirections(directions_options, etp, maneuvers, true);
+}
 
-    // Create the narrative
-    std::unique_ptr<NarrativeBuilder> narrative_builder =
-        NarrativeBuilderFactory::Create(directions_options, etp);
-    narrative_builder->Build(directions_options, etp, maneuvers);
+// Returns the trip directions in the language of the directions options
+// followed by the trip directions in each of its additional languages.
+// The maneuvers are built once and only the narrative is built again for
+// each language.
+std::vector<TripDirections> DirectionsBuilder::BuildLanguages(
+    const DirectionsOptions& directions_options, TripPath& trip_path,
+    StageTimes* stage_times, TraceBuffer* trace) {
+  // Validate trip path node list
+  if (trip_path.node_size() < 1) {
+    throw valhalla_exception_t{400, 210};
   }
 
-  // Return trip directions
-  return PopulateTripDirections(directions_options, etp, maneuvers);
+  EnhancedTripPath* etp = static_cast<EnhancedTripPath*>(&trip_path);
+
+  // Produce maneuvers if the narrative is enabled
+  std::list<Maneuver> maneuvers;
+  if (directions_options.narrative()) {
+    maneuvers = BuildManeuvers(directions_options, etp, stage_times, trace);
+  }
+
+  // Narrate the same maneuvers in one language after the other, the trip
+  // directions keep a copy of the instructions of each language
+  std::vector<TripDirections> trip_directions;
+  trip_directions.reserve(directions_options.languages_size() + 1);
+  DirectionsOptions language_options(directions_options);
+  for (int i = 0; i <= directions_options.languages_size(); ++i) {
+    if (i > 0) {
+      language_options.set_language(directions_options.languages(i - 1));
+      for (auto& maneuver : maneuvers) {
+        maneuver.ClearNarrative();
+      }
+    }
+    if (directions_options.narrative()) {
+      BuildNarrative(language_options, etp, maneuvers, stage_times);
+    }
+
+    ScopedStageTimer timer(stage_times, StageTimes::kPopulate);
+    trip_directions.emplace_back(
+        PopulateTripDirections(language_options, etp, maneuvers,
+                               (i == directions_options.languages_size())));
+  }
+  return trip_directions;
+}
+
+// Returns the maneuvers of the trip path without their narrative.
+std::list<Maneuver> DirectionsBuilder::BuildManeuvers(
+    const DirectionsOptions& directions_options, EnhancedTripPath* etp,
+    StageTimes* stage_times, TraceBuffer* trace) {
+  // Update the heading of ~0 length edges
+  {
+    ScopedStageTimer timer(stage_times, StageTimes::kUpdateHeading);
+    UpdateHeading(etp);
+  }
+
+  // Create maneuvers
+  ManeuversBuilder maneuversBuilder(directions_options, etp, trace);
+  return maneuversBuilder.Build(stage_times);
+}
+
+// Sets the instructions of the maneuvers in the language of the
+// directions options.
+void DirectionsBuilder::BuildNarrative(
+    const DirectionsOptions& directions_options, EnhancedTripPath* etp,
+    std::list<Maneuver>& maneuvers, StageTimes* stage_times) {
+  ScopedStageTimer timer(stage_times, StageTimes::kNarrative);
+  std::unique_ptr<NarrativeBuilder> narrative_builder =
+      NarrativeBuilderFactory::Create(directions_options, etp);
+  narrative_builder->Build(directions_options, etp, maneuvers);
 }
 
 // Update the heading of ~0 length edges.
@@ -123,7 +206,7 @@ void DirectionsBuilder::UpdateHeading(EnhancedTripPath* etp) {
 // trip path, and maneuver list.
 TripDirections DirectionsBuilder::PopulateTripDirections(
     const DirectionsOptions& directions_options, EnhancedTripPath* etp,
-    std::list<Maneuver>& maneuvers) {
+    std::list<Maneuver>& maneuvers, bool last_use) {
   TripDirections trip_directions;
 
   // Populate trip and leg IDs
@@ -175,7 +258,7 @@ TripDirections DirectionsBuilder::PopulateTripDirections(
   }
 
   // Populate maneuvers
-  for (const auto& maneuver : maneuvers) {
+  for (auto& maneuver : maneuvers) {
     auto* trip_maneuver = trip_directions.add_maneuver();
     trip_maneuver->set_type(maneuver.type());
     trip_maneuver->set_text_instruction(maneuver.instruction());
@@ -326,23 +409,28 @@ TripDirections DirectionsBuilder::PopulateTripDirections(
         trip_transit_info->set_operator_url(transit_route.operator_url);
       }
 
-      // Process transit stops
-      for (auto& transit_stop : transit_route.transit_stops) {
+      // Process transit stops, on the last use of the maneuvers their
+      // strings are moved over instead of copied
+      for (auto& transit_stop :
+          maneuver.mutable_transit_info()->transit_stops) {
         auto* trip_transit_stop = trip_transit_info->add_transit_stops();
         trip_transit_stop->set_type(transit_stop.type);
         if (!transit_stop.onestop_id.empty()) {
-          trip_transit_stop->set_onestop_id(transit_stop.onestop_id);
+          SetString(transit_stop.onestop_id,
+                    trip_transit_stop->mutable_onestop_id(), last_use);
         }
         if (!transit_stop.name.empty()) {
-          trip_transit_stop->set_name(transit_stop.name);
+          SetString(transit_stop.name, trip_transit_stop->mutable_name(),
+                    last_use);
         }
         if (!transit_stop.arrival_date_time.empty()) {
-          trip_transit_stop->set_arrival_date_time(
-              transit_stop.arrival_date_time);
+          SetString(transit_stop.arrival_date_time,
+                    trip_transit_stop->mutable_arrival_date_time(), last_use);
         }
         if (!transit_stop.departure_date_time.empty()) {
-          trip_transit_stop->set_departure_date_time(
-              transit_stop.departure_date_time);
+          SetString(transit_stop.departure_date_time,
+                    trip_transit_stop->mutable_departure_date_time(),
+                    last_use);
         }
         if (transit_stop.is_parent_stop) {
           trip_transit_stop->set_is_parent_stop(true);
@@ -350,8 +438,8 @@ TripDirections DirectionsBuilder::PopulateTripDirections(
         if (transit_stop.assumed_schedule) {
           trip_transit_stop->set_assumed_schedule(true);
         }
-        trip_transit_stop->mutable_ll()->set_lat(transit_stop.ll.lat());
-        trip_transit_stop->mutable_ll()->set_lng(transit_stop.ll.lng());
+        trip_transit_stop->mutable_ll()->set_lat(transit_stop.lat);
+        trip_transit_stop->mutable_ll()->set_lng(transit_stop.lng);
       }
     }
 
@@ -360,28 +448,28 @@ TripDirections DirectionsBuilder::PopulateTripDirections(
       trip_maneuver->set_verbal_multi_cue(maneuver.verbal_multi_cue());
 
     // Travel mode
-    trip_maneuver->set_travel_mode(translate_travel_mode.find(maneuver.travel_mode())->second);
+    trip_maneuver->set_travel_mode(translate_travel_mode[maneuver.travel_mode()]);
 
     // Travel type
     switch (maneuver.travel_mode()) {
       case TripPath_TravelMode_kDrive: {
         trip_maneuver->set_vehicle_type(
-            translate_vehicle_type.find(maneuver.vehicle_type())->second);
+            translate_vehicle_type[maneuver.vehicle_type()]);
         break;
       }
       case TripPath_TravelMode_kPedestrian: {
         trip_maneuver->set_pedestrian_type(
-            translate_pedestrian_type.find(maneuver.pedestrian_type())->second);
+            translate_pedestrian_type[maneuver.pedestrian_type()]);
         break;
       }
       case TripPath_TravelMode_kBicycle: {
         trip_maneuver->set_bicycle_type(
-            translate_bicycle_type.find(maneuver.bicycle_type())->second);
+            translate_bicycle_type[maneuver.bicycle_type()]);
         break;
       }
       case TripPath_TravelMode_kTransit: {
         trip_maneuver->set_transit_type(
-            translate_transit_type.find(maneuver.transit_type())->second);
+            translate_transit_type[maneuver.transit_type()]);
         break;
       }
     }
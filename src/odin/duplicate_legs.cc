@@ -0,0 +1,131 @@
+#include <cstring>
+
+#include "odin/directions_cache.h"
+#include "odin/duplicate_legs.h"
+
+namespace {
+
+// The leg id is field 2 of both the trip path and the trip directions
+constexpr uint64_t kLegIdField = 2;
+
+// The leg id field of directions built from a trip path without a leg id,
+// as the builder always sets the leg id and a missing one reads as 0
+const std::string kDefaultLegId("\x10\x00", 2);
+
+bool ReadVarint(const char*& position, const char* end, uint64_t& value) {
+  value = 0;
+  for (int shift = 0; (shift < 64) && (position < end); shift += 7) {
+    uint8_t byte = *position++;
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if ((byte & 0x80) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Returns the offset and size of the serialized leg id field of a message.
+// Fields are serialized in order so only the first few bytes are scanned.
+// Without a leg id the size is 0 and the offset is where it would go.
+std::pair<size_t, size_t> FindLegId(const char* data, size_t size) {
+  const char* position = data;
+  const char* end = data + size;
+  while (position < end) {
+    const char* field = position;
+    uint64_t key, value;
+    if (!ReadVarint(position, end, key)) {
+      return { 0, 0 };
+    }
+    if ((key >> 3) > kLegIdField) {
+      return { field - data, 0 };
+    }
+    switch (key & 7) {
+      case 0:
+        if (!ReadVarint(position, end, value)) {
+          return { 0, 0 };
+        }
+        break;
+      case 1:
+        value = 8;
+        break;
+      case 2:
+        if (!ReadVarint(position, end, value)) {
+          return { 0, 0 };
+        }
+        break;
+      case 5:
+        value = 4;
+        break;
+      default:
+        return { 0, 0 };
+    }
+    // Skip the fixed size and length delimited values
+    if ((key & 7) != 0) {
+      if (value > static_cast<uint64_t>(end - position)) {
+        return { 0, 0 };
+      }
+      position += value;
+    }
+    if ((key >> 3) == kLegIdField) {
+      return { field - data, position - field };
+    }
+  }
+  return { size, 0 };
+}
+
+}
+
+namespace valhalla {
+namespace odin {
+
+size_t DuplicateLegs::Add(const char* trip_path, size_t size) {
+  auto leg_id = FindLegId(trip_path, size);
+  legs_.push_back({ trip_path, size, leg_id.first, leg_id.second,
+                    (leg_id.second > 0)
+                        ? std::string(trip_path + leg_id.first, leg_id.second)
+                        : kDefaultLegId });
+  const auto& leg = legs_.back();
+
+  // Hash everything but the leg id
+  size_t suffix = leg_id.first + leg_id.second;
+  uint64_t hash = DirectionsCache::HashBytes(
+      trip_path + suffix, size - suffix,
+      DirectionsCache::HashBytes(trip_path, leg_id.first));
+
+  // A hash can collide so the bytes are compared too
+  auto range = index_.equal_range(hash);
+  for (auto found = range.first; found != range.second; ++found) {
+    if (Equal(legs_[found->second], leg)) {
+      return found->second;
+    }
+  }
+  index_.emplace(hash, legs_.size() - 1);
+  return legs_.size() - 1;
+}
+
+void DuplicateLegs::SetLegId(size_t leg, std::string& directions) const {
+  auto leg_id = FindLegId(directions.data(), directions.size());
+  directions.replace(leg_id.first, leg_id.second, legs_[leg].leg_id);
+}
+
+void DuplicateLegs::clear() {
+  legs_.clear();
+  index_.clear();
+}
+
+size_t DuplicateLegs::size() const {
+  return legs_.size();
+}
+
+bool DuplicateLegs::Equal(const leg_t& a, const leg_t& b) const {
+  size_t a_suffix = a.leg_id_offset + a.leg_id_size;
+  size_t b_suffix = b.leg_id_offset + b.leg_id_size;
+  return (a.leg_id_offset == b.leg_id_offset)
+      && ((a.size - a_suffix) == (b.size - b_suffix))
+      && (std::memcmp(a.trip_path, b.trip_path, a.leg_id_offset) == 0)
+      && (std::memcmp(a.trip_path + a_suffix, b.trip_path + b_suffix,
+                      a.size - a_suffix) == 0);
+}
+
+}
+}
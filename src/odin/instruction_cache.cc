@@ -0,0 +1,143 @@
+#include <algorithm>
+
+#include "odin/instruction_cache.h"
+
+namespace {
+
+constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+constexpr uint64_t kFnvPrime = 1099511628211ULL;
+
+// Ends each value so that moving characters between values changes the hash
+constexpr unsigned char kValueEnd = 0xff;
+
+using PhraseTag = valhalla::odin::InstructionCache::PhraseTag;
+
+bool SameTagValues(const std::vector<std::string>& tag_values,
+                   std::initializer_list<PhraseTag> phrase_tags) {
+  return (tag_values.size() == phrase_tags.size())
+      && std::equal(phrase_tags.begin(), phrase_tags.end(), tag_values.begin(),
+                    [](const PhraseTag& phrase_tag, const std::string& value) {
+                      return phrase_tag.value == value;
+                    });
+}
+
+}
+
+namespace valhalla {
+namespace odin {
+
+constexpr size_t InstructionCache::kShardCount;
+
+InstructionCache::Key InstructionCache::GetKey(
+    const std::string& phrase, std::initializer_list<PhraseTag> phrase_tags) {
+  // FNV-1a
+  uint64_t hash = kFnvOffsetBasis;
+  for (const auto& phrase_tag : phrase_tags) {
+    for (unsigned char c : phrase_tag.value) {
+      hash = (hash ^ c) * kFnvPrime;
+    }
+    hash = (hash ^ kValueEnd) * kFnvPrime;
+  }
+  return Key{ &phrase, hash };
+}
+
+InstructionCache::InstructionCache(size_t max_entries)
+    : max_entries_(0),
+      max_shard_entries_(0),
+      hits_(0),
+      misses_(0),
+      evictions_(0) {
+  set_max_entries(max_entries);
+}
+
+void InstructionCache::set_max_entries(size_t max_entries) {
+  max_entries_ = max_entries;
+  max_shard_entries_ = (max_entries + kShardCount - 1) / kShardCount;
+  for (auto& shard : shards_) {
+    shard.instructions.clear();
+  }
+}
+
+bool InstructionCache::Find(const Key& key,
+                            std::initializer_list<PhraseTag> phrase_tags,
+                            std::string& instruction) {
+  if (!enabled()) {
+    return false;
+  }
+
+  Shard& shard = GetShard(key);
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto found = shard.instructions.find(key);
+    if ((found != shard.instructions.end())
+        && SameTagValues(found->second.tag_values, phrase_tags)) {
+      instruction = found->second.instruction;
+      ++hits_;
+      return true;
+    }
+  }
+  ++misses_;
+  return false;
+}
+
+void InstructionCache::Insert(const Key& key,
+                              std::initializer_list<PhraseTag> phrase_tags,
+                              const std::string& instruction) {
+  if (!enabled()) {
+    return;
+  }
+
+  Shard& shard = GetShard(key);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto found = shard.instructions.find(key);
+  if (found == shard.instructions.end()) {
+    if (shard.instructions.size() >= max_shard_entries_) {
+      evictions_ += shard.instructions.size();
+      shard.instructions.clear();
+    }
+    found = shard.instructions.emplace(key, Entry()).first;
+  }
+
+  Entry& entry = found->second;
+  entry.tag_values.clear();
+  for (const auto& phrase_tag : phrase_tags) {
+    entry.tag_values.push_back(phrase_tag.value);
+  }
+  entry.instruction = instruction;
+}
+
+bool InstructionCache::enabled() const {
+  return (max_entries_ > 0);
+}
+
+size_t InstructionCache::max_entries() const {
+  return max_entries_;
+}
+
+size_t InstructionCache::size() {
+  size_t size = 0;
+  for (auto& shard : shards_) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    size += shard.instructions.size();
+  }
+  return size;
+}
+
+uint64_t InstructionCache::hits() const {
+  return hits_;
+}
+
+uint64_t InstructionCache::misses() const {
+  return misses_;
+}
+
+uint64_t InstructionCache::evictions() const {
+  return evictions_;
+}
+
+InstructionCache::Shard& InstructionCache::GetShard(const Key& key) {
+  return shards_[KeyHash()(key) % kShardCount];
+}
+
+}
+}
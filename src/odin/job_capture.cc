@@ -0,0 +1,131 @@
+#include <cstdio>
+#include <cstring>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+
+#include <unistd.h>
+
+#include "odin/job_capture.h"
+
+namespace {
+
+constexpr char kMagic[8] = { 'O', 'D', 'I', 'N', 'C', 'A', 'P', '1' };
+
+// Wall clock so the captures of several workers can be merged
+uint64_t Now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+template <class T>
+void WriteValue(std::ofstream& file, const T& value) {
+  file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+template <class T>
+bool ReadValue(std::ifstream& file, T& value) {
+  return static_cast<bool>(
+      file.read(reinterpret_cast<char*>(&value), sizeof(value)));
+}
+
+}
+
+namespace valhalla {
+namespace odin {
+
+JobCapture::JobCapture(const std::string& directory, size_t max_file_bytes,
+                       size_t max_files)
+    : directory_(directory),
+      max_file_bytes_(max_file_bytes),
+      max_files_(max_files),
+      file_index_(0),
+      file_bytes_(0) {
+  // Every worker writes its own files so they never wait on each other
+  static std::atomic<uint32_t> worker_count(0);
+  worker_ = worker_count++;
+  Roll();
+}
+
+void JobCapture::BeginJob(size_t frame_count) {
+  if (file_bytes_ >= max_file_bytes_) {
+    Roll();
+  }
+  WriteValue<uint64_t>(file_, Now());
+  WriteValue<uint32_t>(file_, frame_count);
+  file_bytes_ += sizeof(uint64_t) + sizeof(uint32_t);
+}
+
+void JobCapture::WriteFrame(const void* data, size_t size) {
+  WriteValue<uint32_t>(file_, size);
+  file_.write(static_cast<const char*>(data), size);
+  file_bytes_ += sizeof(uint32_t) + size;
+}
+
+void JobCapture::EndJob() {
+  if (!file_) {
+    throw std::runtime_error("Cannot write the capture " + file_name_);
+  }
+}
+
+void JobCapture::Roll() {
+  if (file_.is_open()) {
+    file_.close();
+  }
+  file_name_ = directory_ + "/odin_capture_" + std::to_string(getpid()) + "_"
+      + std::to_string(worker_) + "_" + std::to_string(file_index_++) + ".bin";
+  file_.open(file_name_, std::ios::binary | std::ios::trunc);
+  if (!file_) {
+    throw std::runtime_error("Cannot write the capture " + file_name_);
+  }
+  file_.write(kMagic, sizeof(kMagic));
+  file_bytes_ = sizeof(kMagic);
+
+  file_names_.push_back(file_name_);
+  while ((max_files_ > 0) && (file_names_.size() > max_files_)) {
+    std::remove(file_names_.front().c_str());
+    file_names_.pop_front();
+  }
+}
+
+std::vector<CapturedJob> JobCapture::Read(const std::string& file_name) {
+  std::ifstream file(file_name, std::ios::binary);
+  char magic[sizeof(kMagic)];
+  if (!file.read(magic, sizeof(magic))
+      || (std::memcmp(magic, kMagic, sizeof(kMagic)) != 0)) {
+    throw std::runtime_error("Not an odin capture " + file_name);
+  }
+
+  // A capture cut short by a crash keeps its complete jobs
+  std::vector<CapturedJob> jobs;
+  CapturedJob job;
+  uint32_t frame_count;
+  while (ReadValue(file, job.timestamp) && ReadValue(file, frame_count)) {
+    job.frames.resize(frame_count);
+    bool complete = true;
+    for (auto& frame : job.frames) {
+      uint32_t size;
+      if (!ReadValue(file, size)) {
+        complete = false;
+        break;
+      }
+      frame.resize(size);
+      if ((size > 0) && !file.read(&frame[0], size)) {
+        complete = false;
+        break;
+      }
+    }
+    if (!complete) {
+      break;
+    }
+    jobs.push_back(job);
+  }
+  return jobs;
+}
+
+const std::string& JobCapture::file_name() const {
+  return file_name_;
+}
+
+}
+}
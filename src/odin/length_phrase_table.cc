@@ -0,0 +1,242 @@
+#include <cmath>
+
+#include <boost/algorithm/string/replace.hpp>
+
+#include "odin/length_phrase_table.h"
+#include "odin/narrative_dictionary.h"
+
+namespace {
+
+constexpr auto kLengthStringInitialCapacity = 32;
+
+// Lengths up to 100 kilometers/miles are precomputed, longer lengths are
+// rendered when requested
+constexpr int kMaxTableTenths = 1000;
+
+// Largest rounded meters and feet that are spoken before switching to
+// tenths of a kilometer/mile. A length just under 0.95 kilometer rounds to
+// 950 meters so it is spoken as 1000 meters.
+constexpr int kMaxTableMeters = 1000;
+constexpr int kMaxTableFeet = 500;
+
+// Returns the meters or feet value that is spoken for the specified length
+int RoundedSmallLength(int length) {
+  if (length > 94) {
+    return ((length + 50) / 100) * 100;
+  } else if (length > 9) {
+    return ((length + 5) / 10) * 10;
+  }
+  return 0;
+}
+
+}
+
+namespace valhalla {
+namespace odin {
+
+LengthPhraseTable::LengthPhraseTable() {
+}
+
+LengthPhraseTable::LengthPhraseTable(
+    const std::vector<std::string>& metric_lengths,
+    const std::vector<std::string>& us_customary_lengths,
+    const NumberFormatter& number_formatter)
+    : metric_lengths_(metric_lengths),
+      us_customary_lengths_(us_customary_lengths),
+      number_formatter_(number_formatter),
+      kilometer_phrases_(kMaxTableTenths + 1),
+      meter_phrases_(kMaxTableMeters / 10 + 1),
+      mile_phrases_(kMaxTableTenths + 1),
+      feet_phrases_(kMaxTableFeet / 10 + 1) {
+
+  // Render each quantized length from a value that falls in its bucket.
+  // Lengths are spoken in tenths of a kilometer/mile, except for a half
+  // and a whole kilometer, below 1 kilometer/mile and 1 tenth of a mile.
+  for (int tenths = 0; tenths <= kMaxTableTenths; ++tenths) {
+    kilometer_phrases_[tenths] = FormMetricLength(tenths / 10.0f);
+    mile_phrases_[tenths] = FormUsCustomaryLength(tenths / 10.0f);
+  }
+
+  // Meters and feet are rendered from the rounded value itself, a bucket
+  // such as 500 meters is never spoken as a half kilometer
+  for (int meters = 0; meters <= kMaxTableMeters; meters += 10) {
+    meter_phrases_[meters / 10] = FormMetersLength(meters);
+  }
+  for (int feet = 0; feet <= kMaxTableFeet; feet += 10) {
+    feet_phrases_[feet / 10] = FormFeetLength(feet);
+  }
+}
+
+std::string LengthPhraseTable::GetMetricLength(float kilometers) const {
+  int tenths = std::round(kilometers * 10);
+  if ((tenths > kMaxTableTenths) || kilometer_phrases_.empty()) {
+    return FormMetricLength(kilometers);
+  } else if (tenths > 10) {
+    // The number is formatted from the length itself, which only rounds to
+    // a different tenth right at the half way point
+    if (std::nearbyint(static_cast<double>(kilometers) * 10) != tenths) {
+      return FormMetricLength(kilometers);
+    }
+    return kilometer_phrases_[tenths];
+  } else if ((tenths == 10) || (tenths == 5)) {
+    return kilometer_phrases_[tenths];
+  }
+  int meters = RoundedSmallLength(std::round(kilometers * 1000));
+  if (meters > kMaxTableMeters) {
+    return FormMetricLength(kilometers);
+  }
+  return meter_phrases_[meters / 10];
+}
+
+std::string LengthPhraseTable::GetUsCustomaryLength(float miles) const {
+  int tenths = std::round(miles * 10);
+  if ((tenths > kMaxTableTenths) || mile_phrases_.empty()) {
+    return FormUsCustomaryLength(miles);
+  } else if (tenths > 10) {
+    // Same as the metric lengths, the number is formatted from the length
+    if (std::nearbyint(static_cast<double>(miles) * 10) != tenths) {
+      return FormUsCustomaryLength(miles);
+    }
+    return mile_phrases_[tenths];
+  } else if ((tenths > 1) || (miles > 0.0973f && tenths == 1)) {
+    return mile_phrases_[tenths];
+  }
+  int feet = RoundedSmallLength(std::round(miles * 5280));
+  if (feet > kMaxTableFeet) {
+    return FormUsCustomaryLength(miles);
+  }
+  return feet_phrases_[feet / 10];
+}
+
+std::string LengthPhraseTable::FormMetricLength(float kilometers) const {
+
+  // 0 "<KILOMETERS> kilometers"
+  // 1 "1 kilometer"
+  // 2 "a half kilometer"
+  // 3 "<METERS> meters" (30-400 and 600-900 meters)
+  // 4 "less than 10 meters"
+
+  std::string length_string;
+  length_string.reserve(kLengthStringInitialCapacity);
+
+  std::string distance;
+  // These will determine what we say
+  int tenths = std::round(kilometers * 10);
+
+  if (tenths > 10) {
+    // 0 "<KILOMETERS> kilometers"
+    length_string += metric_lengths_.at(kKilometersIndex);
+    distance = number_formatter_.Format(kilometers, (tenths % 10 > 0));
+  } else if (tenths == 10) {
+    // 1 "1 kilometer"
+    length_string += metric_lengths_.at(kOneKilometerIndex);
+  } else if (tenths == 5) {
+    // 2 "a half kilometer"
+    length_string += metric_lengths_.at(kHalfKilometerIndex);
+  } else {
+    // 3 "<METERS> meters" (10-90, 100-400 and 600-1000 meters)
+    // 4 "less than 10 meters"
+    return FormMetersLength(RoundedSmallLength(std::round(kilometers * 1000)));
+  }
+
+  //TODO: why do we need separate tags for kilometers and meters?
+  // Replace tags with length values
+  boost::replace_all(length_string, kKilometersTag, distance);
+  boost::replace_all(length_string, kMetersTag, distance);
+
+  return length_string;
+}
+
+std::string LengthPhraseTable::FormUsCustomaryLength(float miles) const {
+
+  // 0  "<MILES> miles"
+  // 1  "1 mile"
+  // 2  "a half mile"
+  // 3  "<TENTHS_OF_MILE> tenths of a mile" (2-4, 6-9)
+  // 4  "1 tenth of a mile"
+  // 5  "<FEET> feet" (10-90, 100-500)
+  // 6  "less than 10 feet"
+
+  std::string length_string;
+  length_string.reserve(kLengthStringInitialCapacity);
+
+  std::string distance;
+  // These will determine what we say
+  int tenths = std::round(miles * 10);
+
+  if (tenths > 10) {
+    // 0  "<MILES> miles"
+    length_string += us_customary_lengths_.at(kMilesIndex);
+    distance = number_formatter_.Format(miles, (tenths % 10 > 0));
+  } else if (tenths == 10) {
+    // 1  "1 mile"
+    length_string += us_customary_lengths_.at(kOneMileIndex);
+  } else if (tenths == 5) {
+    // 2  "a half mile"
+    length_string += us_customary_lengths_.at(kHalfMileIndex);
+  } else if (tenths > 1) {
+    // 3  "<TENTHS_OF_MILE> tenths of a mile" (2-4, 6-9)
+    length_string += us_customary_lengths_.at(kTenthsOfMileIndex);
+    distance = number_formatter_.Format(tenths);
+  } else if (miles > 0.0973f && tenths == 1) {
+    // 4  "1 tenth of a mile"
+    length_string += us_customary_lengths_.at(kOneTenthOfMileIndex);
+  } else {
+    // 5  "<FEET> feet" (10-90, 100-500)
+    // 6  "less than 10 feet"
+    return FormFeetLength(RoundedSmallLength(std::round(miles * 5280)));
+  }
+
+  //TODO: why do we need separate tags for miles, tenths and feet?
+  // Replace tags with length values
+  boost::replace_all(length_string, kMilesTag, distance);
+  boost::replace_all(length_string, kTenthsOfMilesTag, distance);
+  boost::replace_all(length_string, kFeetTag, distance);
+
+  return length_string;
+}
+std::string LengthPhraseTable::FormMetersLength(int meters) const {
+  std::string length_string;
+  length_string.reserve(kLengthStringInitialCapacity);
+
+  std::string distance;
+  if (meters > 0) {
+    // 3 "<METERS> meters"
+    length_string += metric_lengths_.at(kMetersIndex);
+    distance = number_formatter_.Format(meters);
+  } else {
+    // 4 "less than 10 meters"
+    length_string += metric_lengths_.at(kSmallMetersIndex);
+  }
+
+  // Replace tags with length values
+  boost::replace_all(length_string, kKilometersTag, distance);
+  boost::replace_all(length_string, kMetersTag, distance);
+
+  return length_string;
+}
+
+std::string LengthPhraseTable::FormFeetLength(int feet) const {
+  std::string length_string;
+  length_string.reserve(kLengthStringInitialCapacity);
+
+  std::string distance;
+  if (feet > 0) {
+    // 5  "<FEET> feet"
+    length_string += us_customary_lengths_.at(kFeetIndex);
+    distance = number_formatter_.Format(feet);
+  } else {
+    // 6  "less than 10 feet"
+    length_string += us_customary_lengths_.at(kSmallFeetIndex);
+  }
+
+  // Replace tags with length values
+  boost::replace_all(length_string, kMilesTag, distance);
+  boost::replace_all(length_string, kTenthsOfMilesTag, distance);
+  boost::replace_all(length_string, kFeetTag, distance);
+
+  return length_string;
+}
+
+}
+}
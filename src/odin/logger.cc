@@ -0,0 +1,320 @@
+#include <cstdio>
+#include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <valhalla/midgard/logging.h>
+
+#include "odin/logger.h"
+
+namespace {
+
+using valhalla::odin::Logger;
+
+constexpr const char* kLevelNames[] = {
+  "trace",
+  "debug",
+  "info",
+  "warn",
+  "error",
+  "off"
+};
+
+constexpr const char* kCategoryNames[] = {
+  "request",
+  "maneuvers",
+  "cache",
+  "stats",
+  "traces"
+};
+
+// Lines go to the midgard logger unless a sink is set
+void WriteToMidgard(Logger::Level level, Logger::Category category,
+                    const std::string& line) {
+  static const std::string kDirectives[] = {
+    " [TRACE] ", " [DEBUG] ", " [INFO] ", " [WARN] ", " [ERROR] ", " [OFF] "
+  };
+  valhalla::midgard::logging::Log(line, kDirectives[level]);
+}
+
+Logger::sink_t& get_sink() {
+  static Logger::sink_t sink;
+  return sink;
+}
+
+void Sink(Logger::Level level, Logger::Category category,
+          const std::string& line) {
+  const auto& sink = get_sink();
+  if (sink) {
+    sink(level, category, line);
+  } else {
+    WriteToMidgard(level, category, line);
+  }
+}
+
+// Bounded queue of lines written by a background thread. The queued strings
+// keep their capacity so queueing a line does not allocate once warmed up.
+class async_sink_t {
+ public:
+  explicit async_sink_t(size_t queue_size)
+      : lines_(std::max(queue_size, static_cast<size_t>(1))),
+        first_(0),
+        count_(0),
+        writing_(false),
+        stop_(false),
+        dropped_(0),
+        thread_(&async_sink_t::Run, this) {
+  }
+
+  ~async_sink_t() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    queued_.notify_one();
+    thread_.join();
+  }
+
+  void Push(Logger::Level level, Logger::Category category,
+            const std::string& line) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (count_ == lines_.size()) {
+        ++dropped_;
+        return;
+      }
+      auto& queued = lines_[(first_ + count_) % lines_.size()];
+      queued.level = level;
+      queued.category = category;
+      queued.line.assign(line);
+      ++count_;
+    }
+    queued_.notify_one();
+  }
+
+  void Flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    written_.wait(lock, [this]() { return (count_ == 0) && !writing_; });
+  }
+
+  uint64_t dropped() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return dropped_;
+  }
+
+ protected:
+  struct queued_line_t {
+    Logger::Level level;
+    Logger::Category category;
+    std::string line;
+  };
+
+  void Run() {
+    queued_line_t current;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      queued_.wait(lock, [this]() { return stop_ || (count_ > 0); });
+      if (count_ == 0) {
+        break;
+      }
+
+      // Take the line and hand our previous buffer back to the queue
+      std::swap(current, lines_[first_]);
+      first_ = (first_ + 1) % lines_.size();
+      --count_;
+      writing_ = true;
+      lock.unlock();
+      Sink(current.level, current.category, current.line);
+      lock.lock();
+      writing_ = false;
+      if (count_ == 0) {
+        written_.notify_all();
+      }
+    }
+  }
+
+  std::vector<queued_line_t> lines_;
+  size_t first_;
+  size_t count_;
+  bool writing_;
+  bool stop_;
+  uint64_t dropped_;
+  std::mutex mutex_;
+  std::condition_variable queued_;
+  std::condition_variable written_;
+  std::thread thread_;
+};
+
+std::unique_ptr<async_sink_t>& get_async_sink() {
+  static std::unique_ptr<async_sink_t> async_sink;
+  return async_sink;
+}
+
+std::string& get_line_buffer() {
+  thread_local std::string line;
+  return line;
+}
+
+}
+
+namespace valhalla {
+namespace odin {
+
+constexpr size_t Logger::kDefaultQueueSize;
+
+std::atomic<int> Logger::level_(Logger::kInfo);
+std::array<std::atomic<uint32_t>, Logger::kCategoryCount> Logger::sample_rates_;
+
+void Logger::Configure(const boost::property_tree::ptree& config) {
+  auto level = config.get<std::string>("odin.logging.level", "info");
+  bool known_level = false;
+  for (int i = kTrace; i <= kOff; ++i) {
+    if (level == kLevelNames[i]) {
+      SetLevel(static_cast<Level>(i));
+      known_level = true;
+    }
+  }
+  if (!known_level) {
+    SetLevel(kInfo);
+  }
+
+  for (size_t i = 0; i < kCategoryCount; ++i) {
+    SetSampleRate(static_cast<Category>(i), config.get<uint32_t>(
+        std::string("odin.logging.sample.") + kCategoryNames[i], 1));
+  }
+
+  SetAsync(config.get<bool>("odin.logging.async", false),
+           config.get<size_t>("odin.logging.queue_size", kDefaultQueueSize));
+
+  // Written whatever the sample rate so a typo in the level is noticed
+  if (!known_level) {
+    LogLine(kWarn, kRequest).Field("unknown_logging_level", level)
+        .Field("level", kLevelNames[kInfo]);
+  }
+}
+
+void Logger::SetLevel(Level level) {
+  level_.store(level, std::memory_order_relaxed);
+}
+
+void Logger::SetSampleRate(Category category, uint32_t rate) {
+  sample_rates_[category].store(rate, std::memory_order_relaxed);
+}
+
+void Logger::SetSink(sink_t sink) {
+  Flush();
+  get_sink() = std::move(sink);
+}
+
+void Logger::SetAsync(bool async, size_t queue_size) {
+  // The sink outlives the background thread that writes to it
+  get_sink();
+  auto& async_sink = get_async_sink();
+  async_sink.reset();
+  if (async) {
+    async_sink.reset(new async_sink_t(queue_size));
+  }
+}
+
+void Logger::Flush() {
+  auto& async_sink = get_async_sink();
+  if (async_sink) {
+    async_sink->Flush();
+  }
+}
+
+uint64_t Logger::dropped() {
+  auto& async_sink = get_async_sink();
+  return async_sink ? async_sink->dropped() : 0;
+}
+
+void Logger::Write(Level level, Category category, const std::string& line) {
+  auto& async_sink = get_async_sink();
+  if (async_sink) {
+    async_sink->Push(level, category, line);
+  } else {
+    Sink(level, category, line);
+  }
+}
+
+const char* Logger::GetLevelName(Level level) {
+  return kLevelNames[level];
+}
+
+const char* Logger::GetCategoryName(Category category) {
+  return kCategoryNames[category];
+}
+
+bool Logger::IsSampled(Category category, uint32_t rate) {
+  // Each thread samples on its own so the workers do not share a counter
+  thread_local std::array<uint32_t, kCategoryCount> counts{};
+  uint32_t& count = counts[category];
+  if (++count >= rate) {
+    count = 0;
+    return true;
+  }
+  return false;
+}
+
+LogLine::LogLine(Logger::Level level, Logger::Category category)
+    : level_(level),
+      category_(category),
+      line_(get_line_buffer()) {
+  line_.assign(Logger::GetCategoryName(category));
+}
+
+LogLine::~LogLine() {
+  Logger::Write(level_, category_, line_);
+}
+
+LogLine& LogLine::Field(const char* key, const char* value) {
+  AppendKey(key);
+  line_.append(value);
+  return *this;
+}
+
+LogLine& LogLine::Field(const char* key, const std::string& value) {
+  AppendKey(key);
+  line_.append(value);
+  return *this;
+}
+
+LogLine& LogLine::Field(const char* key, double value) {
+  AppendKey(key);
+  char digits[32];
+  int size = std::snprintf(digits, sizeof(digits), "%.3f", value);
+  line_.append(digits, std::min(static_cast<size_t>(std::max(size, 0)),
+                                sizeof(digits) - 1));
+  return *this;
+}
+
+void LogLine::AppendKey(const char* key) {
+  line_.push_back(' ');
+  line_.append(key);
+  line_.push_back('=');
+}
+
+void LogLine::AppendInteger(int64_t value) {
+  if (value < 0) {
+    line_.push_back('-');
+    AppendInteger(static_cast<uint64_t>(0) - static_cast<uint64_t>(value));
+  } else {
+    AppendInteger(static_cast<uint64_t>(value));
+  }
+}
+
+void LogLine::AppendInteger(uint64_t value) {
+  char digits[20];
+  size_t size = 0;
+  do {
+    digits[sizeof(digits) - ++size] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value > 0);
+  line_.append(digits + sizeof(digits) - size, size);
+}
+
+}
+}
@@ -16,6 +16,17 @@
 using namespace valhalla::odin;
 using namespace valhalla::baldr;
 
+namespace {
+
+// The values of the attributes of a maneuver that are not allocated
+const StreetNames kEmptyStreetNames;
+const Signs kEmptySigns;
+const std::string kEmptyInstruction;
+const TransitStop kEmptyTransitStop;
+const TransitRouteInfo kEmptyTransitInfo{};
+
+}
+
 namespace valhalla {
 namespace odin {
 
@@ -36,20 +47,29 @@ const std::unordered_map<int, std::string> Maneuver::relative_direction_string_
         "Maneuver::RelativeDirection::kKeepLeft" } };
 
 Maneuver::Maneuver()
-    : type_(TripDirections_Maneuver_Type_kNone),
+    : verbal_formatter_(nullptr),
       length_(0.0f),
       time_(0),
       basic_time_(0),
       turn_degree_(0),
-      begin_relative_direction_(RelativeDirection::kNone),
-      begin_cardinal_direction_(
-          TripDirections_Maneuver_CardinalDirection_kNorth),
       begin_heading_(0),
       end_heading_(0),
       begin_node_index_(0),
       end_node_index_(0),
       begin_shape_index_(0),
       end_shape_index_(0),
+      internal_right_turn_count_(0),
+      internal_left_turn_count_(0),
+      roundabout_exit_count_(0),
+      type_(TripDirections_Maneuver_Type_kNone),
+      begin_relative_direction_(RelativeDirection::kNone),
+      begin_cardinal_direction_(
+          TripDirections_Maneuver_CardinalDirection_kNorth),
+      travel_mode_(TripPath_TravelMode_kDrive),
+      vehicle_type_(TripPath_VehicleType_kCar),
+      pedestrian_type_(TripPath_PedestrianType_kFoot),
+      bicycle_type_(TripPath_BicycleType_kRoad),
+      transit_type_(TripPath_TransitType_kRail),
       ramp_(false),
       turn_channel_(false),
       ferry_(false),
@@ -59,18 +79,6 @@ Maneuver::Maneuver()
       portions_unpaved_(false),
       portions_highway_(false),
       internal_intersection_(false),
-      internal_right_turn_count_(0),
-      internal_left_turn_count_(0),
-      roundabout_exit_count_(0),
-      travel_mode_(TripPath_TravelMode_kDrive),
-      vehicle_type_(TripPath_VehicleType_kCar),
-      pedestrian_type_(TripPath_PedestrianType_kFoot),
-      bicycle_type_(TripPath_BicycleType_kRoad),
-      transit_type_(TripPath_TransitType_kRail),
-      transit_connection_(false),
-      transit_connection_stop_(TripPath_TransitStopInfo_Type_kStop, "", "", "", "", false, false, 0.0f, 0.0f),
-      rail_(false),
-      bus_(false),
       fork_(false),
       begin_intersecting_edge_name_consistency_(false),
       intersecting_forward_edge_(false),
@@ -78,10 +86,10 @@ Maneuver::Maneuver()
       unnamed_walkway_(false),
       unnamed_cycleway_(false),
       unnamed_mountain_bike_trail_(false),
-      verbal_multi_cue_(false) {
-  street_names_ = midgard::make_unique<StreetNames>();
-  begin_street_names_ = midgard::make_unique<StreetNames>();
-  cross_street_names_ = midgard::make_unique<StreetNames>();
+      verbal_multi_cue_(false),
+      transit_connection_(false),
+      rail_(false),
+      bus_(false) {
 }
 
 const TripDirections_Maneuver_Type& Maneuver::type() const {
@@ -93,7 +101,7 @@ void Maneuver::set_type(const TripDirections_Maneuver_Type& type) {
 }
 
 const StreetNames& Maneuver::street_names() const {
-  return *street_names_;
+  return (street_names_) ? *street_names_ : kEmptyStreetNames;
 }
 
 void Maneuver::set_street_names(const std::vector<std::string>& names) {
@@ -105,7 +113,7 @@ void Maneuver::set_street_names(std::unique_ptr<StreetNames>&& street_names) {
 }
 
 bool Maneuver::HasStreetNames() const {
-  return (!street_names_->empty());
+  return (street_names_ && !street_names_->empty());
 }
 
 bool Maneuver::HasSameNames(
@@ -155,7 +163,7 @@ bool Maneuver::HasSimilarNames(
 }
 
 const StreetNames& Maneuver::begin_street_names() const {
-  return *begin_street_names_;
+  return (begin_street_names_) ? *begin_street_names_ : kEmptyStreetNames;
 }
 
 void Maneuver::set_begin_street_names(const std::vector<std::string>& names) {
@@ -168,11 +176,11 @@ void Maneuver::set_begin_street_names(
 }
 
 bool Maneuver::HasBeginStreetNames() const {
-  return (!begin_street_names_->empty());
+  return (begin_street_names_ && !begin_street_names_->empty());
 }
 
 const StreetNames& Maneuver::cross_street_names() const {
-  return *cross_street_names_;
+  return (cross_street_names_) ? *cross_street_names_ : kEmptyStreetNames;
 }
 
 void Maneuver::set_cross_street_names(const std::vector<std::string>& names) {
@@ -185,19 +193,19 @@ void Maneuver::set_cross_street_names(
 }
 
 bool Maneuver::HasCrossStreetNames() const {
-  return (!cross_street_names_->empty());
+  return (cross_street_names_ && !cross_street_names_->empty());
 }
 
 const std::string& Maneuver::instruction() const {
-  return instruction_;
+  return (narrative_) ? narrative_->instruction : kEmptyInstruction;
 }
 
 void Maneuver::set_instruction(const std::string& instruction) {
-  instruction_ = instruction;
+  mutable_narrative()->instruction = instruction;
 }
 
 void Maneuver::set_instruction(std::string&& instruction) {
-  instruction_ = std::move(instruction);
+  mutable_narrative()->instruction = std::move(instruction);
 }
 
 float Maneuver::length(const DirectionsOptions::Units& units) const {
@@ -375,7 +383,7 @@ void Maneuver::set_internal_intersection(bool internal_intersection) {
 
 bool Maneuver::HasUsableInternalIntersectionName() const {
   uint32_t link_count = (end_node_index_ - begin_node_index_);
-  if (internal_intersection_ && !street_names_->empty()
+  if (internal_intersection_ && HasStreetNames()
       && ((link_count == 1) || (link_count == 3))) {
     return true;
   }
@@ -383,31 +391,34 @@ bool Maneuver::HasUsableInternalIntersectionName() const {
 }
 
 const Signs& Maneuver::signs() const {
-  return signs_;
+  return (signs_) ? *signs_ : kEmptySigns;
 }
 
 Signs* Maneuver::mutable_signs() {
-  return &signs_;
+  if (!signs_) {
+    signs_ = midgard::make_unique<Signs>();
+  }
+  return signs_.get();
 }
 
 bool Maneuver::HasExitSign() const {
-  return signs_.HasExit();
+  return (signs_ && signs_->HasExit());
 }
 
 bool Maneuver::HasExitNumberSign() const {
-  return signs_.HasExitNumber();
+  return (signs_ && signs_->HasExitNumber());
 }
 
 bool Maneuver::HasExitBranchSign() const {
-  return signs_.HasExitBranch();
+  return (signs_ && signs_->HasExitBranch());
 }
 
 bool Maneuver::HasExitTowardSign() const {
-  return signs_.HasExitToward();
+  return (signs_ && signs_->HasExitToward());
 }
 
 bool Maneuver::HasExitNameSign() const {
-  return signs_.HasExitName();
+  return (signs_ && signs_->HasExitName());
 }
 
 uint32_t Maneuver::internal_right_turn_count() const {
@@ -462,60 +473,66 @@ void Maneuver::set_intersecting_forward_edge(bool intersecting_forward_edge) {
 }
 
 const std::string& Maneuver::verbal_transition_alert_instruction() const {
-  return verbal_transition_alert_instruction_;
+  return (narrative_) ? narrative_->verbal_transition_alert_instruction
+                      : kEmptyInstruction;
 }
 
 void Maneuver::set_verbal_transition_alert_instruction(
     const std::string& verbal_transition_alert_instruction) {
-  verbal_transition_alert_instruction_ = verbal_transition_alert_instruction;
+  mutable_narrative()->verbal_transition_alert_instruction =
+      verbal_transition_alert_instruction;
 }
 
 void Maneuver::set_verbal_transition_alert_instruction(
     std::string&& verbal_transition_alert_instruction) {
-  verbal_transition_alert_instruction_ = std::move(
+  mutable_narrative()->verbal_transition_alert_instruction = std::move(
       verbal_transition_alert_instruction);
 }
 
 bool Maneuver::HasVerbalTransitionAlertInstruction() const {
-  return (!verbal_transition_alert_instruction_.empty());
+  return (!verbal_transition_alert_instruction().empty());
 }
 
 const std::string& Maneuver::verbal_pre_transition_instruction() const {
-  return verbal_pre_transition_instruction_;
+  return (narrative_) ? narrative_->verbal_pre_transition_instruction
+                      : kEmptyInstruction;
 }
 
 void Maneuver::set_verbal_pre_transition_instruction(
     const std::string& verbal_pre_transition_instruction) {
-  verbal_pre_transition_instruction_ = verbal_pre_transition_instruction;
+  mutable_narrative()->verbal_pre_transition_instruction =
+      verbal_pre_transition_instruction;
 }
 
 void Maneuver::set_verbal_pre_transition_instruction(
     std::string&& verbal_pre_transition_instruction) {
-  verbal_pre_transition_instruction_ = std::move(
+  mutable_narrative()->verbal_pre_transition_instruction = std::move(
       verbal_pre_transition_instruction);
 }
 
 bool Maneuver::HasVerbalPreTransitionInstruction() const {
-  return (!verbal_pre_transition_instruction_.empty());
+  return (!verbal_pre_transition_instruction().empty());
 }
 
 const std::string& Maneuver::verbal_post_transition_instruction() const {
-  return verbal_post_transition_instruction_;
+  return (narrative_) ? narrative_->verbal_post_transition_instruction
+                      : kEmptyInstruction;
 }
 
 void Maneuver::set_verbal_post_transition_instruction(
     const std::string& verbal_post_transition_instruction) {
-  verbal_post_transition_instruction_ = verbal_post_transition_instruction;
+  mutable_narrative()->verbal_post_transition_instruction =
+      verbal_post_transition_instruction;
 }
 
 void Maneuver::set_verbal_post_transition_instruction(
     std::string&& verbal_post_transition_instruction) {
-  verbal_post_transition_instruction_ = std::move(
+  mutable_narrative()->verbal_post_transition_instruction = std::move(
       verbal_post_transition_instruction);
 }
 
 bool Maneuver::HasVerbalPostTransitionInstruction() const {
-  return (!verbal_post_transition_instruction_.empty());
+  return (!verbal_post_transition_instruction().empty());
 }
 
 bool Maneuver::tee() const {
@@ -607,13 +624,19 @@ void Maneuver::set_transit_connection(bool transit_connection) {
 }
 
 const TransitStop& Maneuver::transit_connection_stop() const {
-  return transit_connection_stop_;
+  return (transit_) ? transit_->transit_connection_stop : kEmptyTransitStop;
 }
 
 void Maneuver::set_transit_connection_stop(
     const TransitStop& transit_connection_stop) {
-  transit_connection_stop_ = transit_connection_stop;
-  LOG_TRACE("set_transit_connection_stop=" + transit_connection_stop_.ToParameterString());
+  mutable_transit()->transit_connection_stop = transit_connection_stop;
+  LOG_TRACE("set_transit_connection_stop=" + transit_connection_stop.ToParameterString());
+}
+
+void Maneuver::set_transit_connection_stop(
+    TransitStop&& transit_connection_stop) {
+  mutable_transit()->transit_connection_stop = std::move(transit_connection_stop);
+  LOG_TRACE("set_transit_connection_stop=" + transit_->transit_connection_stop.ToParameterString());
 }
 
 bool Maneuver::rail() const {
@@ -639,91 +662,132 @@ bool Maneuver::IsTransit() const {
 }
 
 const TransitRouteInfo& Maneuver::transit_info() const {
-  return transit_info_;
+  return (transit_) ? transit_->transit_info : kEmptyTransitInfo;
 }
 
 TransitRouteInfo* Maneuver::mutable_transit_info() {
-  return &transit_info_;
+  return &mutable_transit()->transit_info;
 }
 
 std::string Maneuver::GetTransitArrivalTime() const {
-  return transit_info_.transit_stops.back().arrival_date_time;
+  return transit_info().transit_stops.back().arrival_date_time;
 }
 
 std::string Maneuver::GetTransitDepartureTime() const {
-  return transit_info_.transit_stops.front().departure_date_time;
+  return transit_info().transit_stops.front().departure_date_time;
 }
 
-const std::list<TransitStop>& Maneuver::GetTransitStops() const {
-  return transit_info_.transit_stops;
+int64_t Maneuver::GetTransitArrivalLocalTime() const {
+  return transit_info().transit_stops.back().arrival_local_time;
+}
+
+int64_t Maneuver::GetTransitDepartureLocalTime() const {
+  return transit_info().transit_stops.front().departure_local_time;
+}
+
+const TransitStops& Maneuver::GetTransitStops() const {
+  return transit_info().transit_stops;
 }
 
 size_t Maneuver::GetTransitStopCount() const {
-  return
-      (transit_info_.transit_stops.size() > 0) ?
-          (transit_info_.transit_stops.size() - 1) : 0;
+  const auto& transit_stops = transit_info().transit_stops;
+  return (transit_stops.size() > 0) ? (transit_stops.size() - 1) : 0;
 }
 
 void Maneuver::InsertTransitStop(TransitStop&& transit_stop) {
-  transit_info_.transit_stops.push_front(std::move(transit_stop));
-  LOG_TRACE("InsertTransitStop=" + transit_info_.transit_stops.front().ToParameterString());
+  auto& transit_stops = mutable_transit_info()->transit_stops;
+  transit_stops.push_front(std::move(transit_stop));
+  LOG_TRACE("InsertTransitStop=" + transit_stops.front().ToParameterString());
 }
 
 const std::string& Maneuver::depart_instruction() const {
-  return depart_instruction_;
+  return (narrative_) ? narrative_->depart_instruction : kEmptyInstruction;
 }
 
 void Maneuver::set_depart_instruction(const std::string& depart_instruction) {
-  depart_instruction_ = depart_instruction;
+  mutable_narrative()->depart_instruction = depart_instruction;
 }
 
 void Maneuver::set_depart_instruction(std::string&& depart_instruction) {
-  depart_instruction_ = std::move(depart_instruction);
+  mutable_narrative()->depart_instruction = std::move(depart_instruction);
 }
 
 const std::string& Maneuver::verbal_depart_instruction() const {
-  return verbal_depart_instruction_;
+  return (narrative_) ? narrative_->verbal_depart_instruction
+                      : kEmptyInstruction;
 }
 
 void Maneuver::set_verbal_depart_instruction(const std::string& verbal_depart_instruction) {
-  verbal_depart_instruction_ = verbal_depart_instruction;
+  mutable_narrative()->verbal_depart_instruction = verbal_depart_instruction;
 }
 
 void Maneuver::set_verbal_depart_instruction(std::string&& verbal_depart_instruction) {
-  verbal_depart_instruction_ = std::move(verbal_depart_instruction);
+  mutable_narrative()->verbal_depart_instruction = std::move(
+      verbal_depart_instruction);
 }
 
 const std::string& Maneuver::arrive_instruction() const {
-  return arrive_instruction_;
+  return (narrative_) ? narrative_->arrive_instruction : kEmptyInstruction;
 }
 
 void Maneuver::set_arrive_instruction(const std::string& arrive_instruction) {
-  arrive_instruction_ = arrive_instruction;
+  mutable_narrative()->arrive_instruction = arrive_instruction;
 }
 
 void Maneuver::set_arrive_instruction(std::string&& arrive_instruction) {
-  arrive_instruction_ = std::move(arrive_instruction);
+  mutable_narrative()->arrive_instruction = std::move(arrive_instruction);
 }
 
 const std::string& Maneuver::verbal_arrive_instruction() const {
-  return verbal_arrive_instruction_;
+  return (narrative_) ? narrative_->verbal_arrive_instruction
+                      : kEmptyInstruction;
 }
 
 void Maneuver::set_verbal_arrive_instruction(const std::string& verbal_arrive_instruction) {
-  verbal_arrive_instruction_ = verbal_arrive_instruction;
+  mutable_narrative()->verbal_arrive_instruction = verbal_arrive_instruction;
 }
 
 void Maneuver::set_verbal_arrive_instruction(std::string&& verbal_arrive_instruction) {
-  verbal_arrive_instruction_ = std::move(verbal_arrive_instruction);
+  mutable_narrative()->verbal_arrive_instruction = std::move(
+      verbal_arrive_instruction);
 }
 
 const VerbalTextFormatter* Maneuver::verbal_formatter() const {
-  return verbal_formatter_.get();
+  return verbal_formatter_;
 }
 
 void Maneuver::set_verbal_formatter(
-    std::unique_ptr<VerbalTextFormatter>&& verbal_formatter) {
-  verbal_formatter_ = std::move(verbal_formatter);
+    const VerbalTextFormatter* verbal_formatter) {
+  verbal_formatter_ = verbal_formatter;
+}
+
+void Maneuver::ClearNarrative() {
+  // Keep the strings so the next narrative reuses their capacity
+  if (narrative_) {
+    narrative_->instruction.clear();
+    narrative_->verbal_transition_alert_instruction.clear();
+    narrative_->verbal_pre_transition_instruction.clear();
+    narrative_->verbal_post_transition_instruction.clear();
+    narrative_->depart_instruction.clear();
+    narrative_->verbal_depart_instruction.clear();
+    narrative_->arrive_instruction.clear();
+    narrative_->verbal_arrive_instruction.clear();
+  }
+  verbal_multi_cue_ = false;
+}
+
+Maneuver::Narrative* Maneuver::mutable_narrative() {
+  if (!narrative_) {
+    narrative_ = midgard::make_unique<Narrative>();
+  }
+  return narrative_.get();
+}
+
+Maneuver::Transit* Maneuver::mutable_transit() {
+  if (!transit_) {
+    transit_ = midgard::make_unique<Transit>();
+  }
+  return transit_.get();
 }
 
 
@@ -735,16 +799,16 @@ std::string Maneuver::ToString() const {
   man_str += std::to_string(type_);
 
   man_str += " | street_names_=";
-  man_str += street_names_->ToString();
+  man_str += street_names().ToString();
 
   man_str += " | begin_street_names=";
-  man_str += begin_street_names_->ToString();
+  man_str += begin_street_names().ToString();
 
   man_str += " | cross_street_names=";
-  man_str += cross_street_names_->ToString();
+  man_str += cross_street_names().ToString();
 
   man_str += " | instruction=";
-  man_str += instruction_;
+  man_str += instruction();
 
   man_str += " | distance_=";
   man_str += std::to_string(length_);
@@ -807,7 +871,7 @@ std::string Maneuver::ToString() const {
   man_str += std::to_string(internal_intersection_);
 
   man_str += " | ";
-  man_str += signs_.ToString();
+  man_str += signs().ToString();
 
   man_str += " | internal_right_turn_count=";
   man_str += std::to_string(internal_right_turn_count_);
@@ -828,13 +892,13 @@ std::string Maneuver::ToString() const {
   man_str += std::to_string(intersecting_forward_edge_);
 
   man_str += " | verbal_transition_alert_instruction=";
-  man_str += verbal_transition_alert_instruction_;
+  man_str += verbal_transition_alert_instruction();
 
   man_str += " | verbal_pre_transition_instruction=";
-  man_str += verbal_pre_transition_instruction_;
+  man_str += verbal_pre_transition_instruction();
 
   man_str += " | verbal_post_transition_instruction=";
-  man_str += verbal_post_transition_instruction_;
+  man_str += verbal_post_transition_instruction();
 
   man_str += " | tee=";
   man_str += std::to_string(tee_);
@@ -890,17 +954,17 @@ std::string Maneuver::ToParameterString() const {
       ->name();
 
   man_str += delim;
-  man_str += street_names_->ToParameterString();
+  man_str += street_names().ToParameterString();
 
   man_str += delim;
-  man_str += begin_street_names_->ToParameterString();
+  man_str += begin_street_names().ToParameterString();
 
   man_str += delim;
-  man_str += cross_street_names_->ToParameterString();
+  man_str += cross_street_names().ToParameterString();
 
   man_str += delim;
   man_str += "\"";
-  man_str += instruction_;
+  man_str += instruction();
   man_str += "\"";
 
   man_str += delim;
@@ -967,7 +1031,7 @@ std::string Maneuver::ToParameterString() const {
   man_str += std::to_string(internal_intersection_);
 
   man_str += delim;
-  man_str += signs_.ToParameterString();
+  man_str += signs().ToParameterString();
 
   man_str += delim;
   man_str += std::to_string(internal_right_turn_count_);
@@ -989,17 +1053,17 @@ std::string Maneuver::ToParameterString() const {
 
   man_str += delim;
   man_str += "\"";
-  man_str += verbal_transition_alert_instruction_;
+  man_str += verbal_transition_alert_instruction();
   man_str += "\"";
 
   man_str += delim;
   man_str += "\"";
-  man_str += verbal_pre_transition_instruction_;
+  man_str += verbal_pre_transition_instruction();
   man_str += "\"";
 
   man_str += delim;
   man_str += "\"";
-  man_str += verbal_post_transition_instruction_;
+  man_str += verbal_post_transition_instruction();
   man_str += "\"";
 
   man_str += delim;
@@ -18,29 +18,30 @@
 #include <valhalla/baldr/streetnames_factory.h>
 #include <valhalla/baldr/verbal_text_formatter.h>
 #include <valhalla/baldr/verbal_text_formatter_us.h>
-#include <valhalla/baldr/verbal_text_formatter_factory.h>
 #include <valhalla/baldr/errorcode_util.h>
 
 #include "proto/tripdirections.pb.h"
 #include "proto/directions_options.pb.h"
 #include "odin/maneuversbuilder.h"
+#include "odin/logger.h"
 #include "odin/signs.h"
 #include "odin/sign.h"
+#include "odin/util.h"
 
 using namespace valhalla::midgard;
 using namespace valhalla::baldr;
 using namespace valhalla::odin;
 
 namespace {
-void SortExitSignList(std::vector<Sign>* signs) {
+void SortExitSignList(SignList* signs) {
   // Sort signs by descending consecutive count order
   std::sort(signs->begin(), signs->end(), [](Sign a, Sign b) {
     return b.consecutive_count() < a.consecutive_count();
   });
 }
 
-void CountAndSortExitSignList(std::vector<Sign>* prev_signs,
-                              std::vector<Sign>* curr_signs) {
+void CountAndSortExitSignList(SignList* prev_signs,
+                              SignList* curr_signs) {
   // Increment count for consecutive exit signs
   for (Sign& curr_sign : *curr_signs) {
     for (Sign& prev_sign : *prev_signs) {
@@ -56,56 +57,88 @@ void CountAndSortExitSignList(std::vector<Sign>* prev_signs,
   SortExitSignList(curr_signs);
 }
 
+// The maneuver rules of a leg whose edges all have the travel mode kMode
+// and no transit connections. The travel mode of every maneuver is kMode so
+// the transit and mode change rules are pruned at compile time.
+template <TripPath_TravelMode kMode>
+struct SingleMode {
+  static_assert(kMode != TripPath_TravelMode_kTransit,
+                "Transit legs have transit connections");
+  static constexpr bool kMixed = false;
+  static TripPath_TravelMode TravelMode(TripPath_TravelMode) {
+    return kMode;
+  }
+};
+
+using DriveMode = SingleMode<TripPath_TravelMode_kDrive>;
+using PedestrianMode = SingleMode<TripPath_TravelMode_kPedestrian>;
+using BicycleMode = SingleMode<TripPath_TravelMode_kBicycle>;
+
+// The maneuver rules of a multimodal leg, which check the travel mode and
+// the transit attributes of every edge
+struct MixedMode {
+  static constexpr bool kMixed = true;
+  static TripPath_TravelMode TravelMode(TripPath_TravelMode travel_mode) {
+    return travel_mode;
+  }
+};
+
 }
 
 namespace valhalla {
 namespace odin {
 
 ManeuversBuilder::ManeuversBuilder(const DirectionsOptions& directions_options,
-                                   EnhancedTripPath* etp)
+                                   EnhancedTripPath* etp, TraceBuffer* trace)
     : directions_options_(directions_options),
-      trip_path_(etp) {
+      trip_path_(etp),
+      trace_(trace) {
 }
 
-std::list<Maneuver> ManeuversBuilder::Build() {
+std::list<Maneuver> ManeuversBuilder::Build(StageTimes* stage_times) {
   // Create the maneuvers
-  std::list<Maneuver> maneuvers = Produce();
+  std::list<Maneuver> maneuvers;
+  {
+    ScopedStageTimer timer(stage_times, StageTimes::kProduce);
+
+    // Select the maneuver rules of the travel mode of the leg
+    TripPath_TravelMode travel_mode;
+    if (!GetSingleTravelMode(travel_mode)) {
+      maneuvers = Produce<MixedMode>();
+    } else if (travel_mode == TripPath_TravelMode_kDrive) {
+      maneuvers = Produce<DriveMode>();
+    } else if (travel_mode == TripPath_TravelMode_kPedestrian) {
+      maneuvers = Produce<PedestrianMode>();
+    } else if (travel_mode == TripPath_TravelMode_kBicycle) {
+      maneuvers = Produce<BicycleMode>();
+    } else {
+      maneuvers = Produce<MixedMode>();
+    }
+  }
 
-#ifdef LOGGING_LEVEL_TRACE
-  int man_id = 1;
-  LOG_TRACE("############################################");
-  LOG_TRACE("MANEUVERS");
-  for (const Maneuver& maneuver : maneuvers) {
-    LOG_TRACE("---------------------------------------------");
-    LOG_TRACE(std::to_string(man_id++) + ":  ");
-    LOG_TRACE(std::string("  maneuver_PARAMETERS=") + maneuver.ToParameterString());
-    LOG_TRACE(std::string("  maneuver=") + maneuver.ToString());
+  if (trace_) {
+    TraceManeuvers(maneuvers, TraceEvent::kManeuver);
   }
-#endif
 
-  // Combine maneuvers
-  Combine(maneuvers);
+  {
+    ScopedStageTimer timer(stage_times, StageTimes::kCombine);
 
-  // Calculate the consecutive exit sign count and then sort
-  CountAndSortExitSigns(maneuvers);
+    // Combine maneuvers
+    Combine(maneuvers);
 
-  // Confirm maneuver type assignment
-  ConfirmManeuverTypeAssignment(maneuvers);
+    // Calculate the consecutive exit sign count and then sort
+    CountAndSortExitSigns(maneuvers);
 
-  // Enhance signless interchanges
-  EnhanceSignlessInterchnages(maneuvers);
+    // Confirm maneuver type assignment
+    ConfirmManeuverTypeAssignment(maneuvers);
 
-#ifdef LOGGING_LEVEL_TRACE
-  int combined_man_id = 1;
-  LOG_TRACE("############################################");
-  LOG_TRACE("COMBINED MANEUVERS");
-  for (const Maneuver& maneuver : maneuvers) {
-    LOG_TRACE("---------------------------------------------");
-    LOG_TRACE(std::to_string(combined_man_id++) + ":  ");
-    LOG_TRACE(std::string("  maneuver_PARAMETERS=") + maneuver.ToParameterString());
-    LOG_TRACE(std::string("  maneuver=") + maneuver.ToString());
+    // Enhance signless interchanges
+    EnhanceSignlessInterchnages(maneuvers);
+  }
+
+  if (trace_) {
+    TraceManeuvers(maneuvers, TraceEvent::kCombinedManeuver);
   }
-#endif
 
 #ifdef LOGGING_LEVEL_DEBUG
   std::vector<PointLL> shape = midgard::decode<std::vector<PointLL> >(
@@ -143,6 +176,24 @@ std::list<Maneuver> ManeuversBuilder::Build() {
   return maneuvers;
 }
 
+bool ManeuversBuilder::GetSingleTravelMode(
+    TripPath_TravelMode& travel_mode) const {
+  // The last node has no edge
+  if (trip_path_->node_size() < 2) {
+    return false;
+  }
+  travel_mode = trip_path_->node(0).edge().travel_mode();
+  for (int i = 0; i < trip_path_->GetLastNodeIndex(); ++i) {
+    const auto& edge = trip_path_->node(i).edge();
+    if ((edge.travel_mode() != travel_mode)
+        || (edge.use() == TripPath_Use_kTransitConnectionUse)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class Mode>
 std::list<Maneuver> ManeuversBuilder::Produce() {
   std::list<Maneuver> maneuvers;
 
@@ -162,9 +213,7 @@ std::list<Maneuver> ManeuversBuilder::Produce() {
     throw valhalla_exception_t{400, 212};
   }
 
-  LOG_INFO(
-      std::string(
-          "trip_path_->node_size()=" + std::to_string(trip_path_->node_size())));
+  ODIN_LOG(kDebug, kManeuvers).Field("node_count", trip_path_->node_size());
 
   // Process the Destination maneuver
   maneuvers.emplace_front();
@@ -174,77 +223,41 @@ std::list<Maneuver> ManeuversBuilder::Produce() {
 
   // Initialize maneuver prior to loop
   maneuvers.emplace_front();
-  InitializeManeuver(maneuvers.front(), trip_path_->GetLastNodeIndex());
+  InitializeManeuver<Mode>(maneuvers.front(), trip_path_->GetLastNodeIndex());
 
   // Step through nodes in reverse order to produce maneuvers
   // excluding the last and first nodes
   for (int i = (trip_path_->GetLastNodeIndex() - 1); i > 0; --i) {
 
-#ifdef LOGGING_LEVEL_TRACE
-    auto* prev_edge = trip_path_->GetPrevEdge(i);
-    auto* curr_edge = trip_path_->GetCurrEdge(i);
-    auto* next_edge = trip_path_->GetNextEdge(i);
-    LOG_TRACE("---------------------------------------------");
-    LOG_TRACE(std::to_string(i) + ":  ");
-    LOG_TRACE(std::string("  curr_edge_PARAMETERS=") + (curr_edge ? curr_edge->ToParameterString() : "NONE"));
-    LOG_TRACE(std::string("  curr_edge=") + (curr_edge ? curr_edge->ToString() : "NONE"));
-    LOG_TRACE(std::string("  prev2curr_turn_degree=") + std::to_string(
-            GetTurnDegree(prev_edge->end_heading(), curr_edge->begin_heading())));
-    auto* node = trip_path_->GetEnhancedNode(i);
-    for (size_t z = 0; z < node->intersecting_edge_size(); ++z) {
-      auto* intersecting_edge = node->GetIntersectingEdge(z);
-      LOG_TRACE(std::string("    intersectingEdge=") + intersecting_edge->ToString());
-      LOG_TRACE(std::string("    prev2int_turn_degree=") + std::to_string(
-              GetTurnDegree(prev_edge->end_heading(), intersecting_edge->begin_heading())));
+    if (trace_) {
+      TraceNode(i);
     }
-    LOG_TRACE(std::string("  node=") + node->ToString());
-    IntersectingEdgeCounts xedge_counts;
-    node->CalculateRightLeftIntersectingEdgeCounts(prev_edge->end_heading(),
-        prev_edge->travel_mode(),
-        xedge_counts);
-    LOG_TRACE(std::string("    right=") + std::to_string(xedge_counts.right)
-        + std::string(" | right_similar=") + std::to_string(xedge_counts.right_similar)
-        + std::string(" | right_traversable_outbound=") + std::to_string(xedge_counts.right_traversable_outbound)
-        + std::string(" | right_similar_traversable_outbound=") + std::to_string(xedge_counts.right_similar_traversable_outbound));
-    LOG_TRACE(std::string("    left =") + std::to_string(xedge_counts.left)
-        + std::string(" | left_similar =") + std::to_string(xedge_counts.left_similar)
-        + std::string(" | left_traversable_outbound =") + std::to_string(xedge_counts.left_traversable_outbound)
-        + std::string(" | left_similar_traversable_outbound =") + std::to_string(xedge_counts.left_similar_traversable_outbound));
-#endif
 
-    if (CanManeuverIncludePrevEdge(maneuvers.front(), i)) {
-      UpdateManeuver(maneuvers.front(), i);
+    if (CanManeuverIncludePrevEdge<Mode>(maneuvers.front(), i)) {
+      if (trace_) {
+        trace_->Add(TraceEvent::kManeuverUpdate, 0, i);
+      }
+      UpdateManeuver<Mode>(maneuvers.front(), i);
     } else {
+      if (trace_) {
+        trace_->Add(TraceEvent::kManeuverBegin, 0, i);
+      }
+
       // Finalize current maneuver
-      FinalizeManeuver(maneuvers.front(), i);
+      FinalizeManeuver<Mode>(maneuvers.front(), i);
 
       // Initialize new maneuver
       maneuvers.emplace_front();
-      InitializeManeuver(maneuvers.front(), i);
+      InitializeManeuver<Mode>(maneuvers.front(), i);
     }
   }
 
-#ifdef LOGGING_LEVEL_TRACE
-  auto* curr_edge = trip_path_->GetCurrEdge(0);
-  LOG_TRACE("---------------------------------------------");
-  LOG_TRACE(std::string("0") + ":  ");
-  LOG_TRACE(std::string("  curr_edge_PARAMETERS=") + (curr_edge ? curr_edge->ToParameterString() : "NONE"));
-  LOG_TRACE(std::string("  curr_edge=") + (curr_edge ? curr_edge->ToString() : "NONE"));
-  auto* node = trip_path_->GetEnhancedNode(0);
-  for (size_t z = 0; z < node->intersecting_edge_size(); ++z) {
-    auto* intersecting_edge = node->GetIntersectingEdge(z);
-    LOG_TRACE(std::string("    intersectingEdge=") + intersecting_edge->ToString());
-  }
-  LOG_TRACE("@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@@");
-  for (size_t z = 0; z < trip_path_->admin_size(); ++z) {
-    auto* admin = trip_path_->GetAdmin(z);
-    LOG_TRACE("ADMIN " + std::to_string(z) + ": " + admin->ToString());
+  if (trace_) {
+    TraceNode(0);
   }
 
-#endif
-
   // Process the Start maneuver
-  CreateStartManeuver(maneuvers.front());
+  CreateStartManeuver<Mode>(maneuvers.front());
 
   return maneuvers;
 }
@@ -279,6 +292,9 @@ void ManeuversBuilder::Combine(std::list<Maneuver>& maneuvers) {
           && next_man->IsTransit()
           && curr_man->transit_connection_stop().type == TripDirections_TransitStop_Type_kStop) {
         LOG_TRACE("+++ Combine: Collapse the TransitConnectionStart Maneuver +++");
+        if (trace_) {
+          TraceCombine(TraceEvent::kCollapseTransitConnectionStart, *curr_man, *next_man);
+        }
         curr_man = CollapseTransitConnectionStartManeuver(maneuvers, curr_man, next_man);
         maneuvers_have_been_combined = true;
         ++next_man;
@@ -289,6 +305,9 @@ void ManeuversBuilder::Combine(std::list<Maneuver>& maneuvers) {
           && curr_man->IsTransit()
           && next_man->transit_connection_stop().type == TripDirections_TransitStop_Type_kStop) {
         LOG_TRACE("+++ Combine: Collapse the TransitConnectionDestination Maneuver +++");
+        if (trace_) {
+          TraceCombine(TraceEvent::kCollapseTransitConnectionDestination, *curr_man, *next_man);
+        }
         next_man = CollapseTransitConnectionDestinationManeuver(maneuvers, curr_man, next_man);
         maneuvers_have_been_combined = true;
       }
@@ -296,6 +315,9 @@ void ManeuversBuilder::Combine(std::list<Maneuver>& maneuvers) {
       // if any transit connection maneuvers
       else if (curr_man->transit_connection() || next_man->transit_connection()) {
         LOG_TRACE("+++ Do Not Combine: if any transit connection maneuvers +++");
+        if (trace_) {
+          TraceCombine(TraceEvent::kNoCombineTransitConnection, *curr_man, *next_man);
+        }
         // Update with no combine
         prev_man = curr_man;
         curr_man = next_man;
@@ -307,6 +329,9 @@ void ManeuversBuilder::Combine(std::list<Maneuver>& maneuvers) {
       else if ((curr_man->travel_mode() != next_man->travel_mode())
           || (next_man->type() == TripDirections_Maneuver_Type_kDestination)) {
         LOG_TRACE("+++ Do Not Combine: if travel mode is different or next maneuver is destination +++");
+        if (trace_) {
+          TraceCombine(TraceEvent::kNoCombineTravelModeOrDestination, *curr_man, *next_man);
+        }
         // Update with no combine
         prev_man = curr_man;
         curr_man = next_man;
@@ -316,6 +341,9 @@ void ManeuversBuilder::Combine(std::list<Maneuver>& maneuvers) {
       // if next maneuver is a fork or a tee
       else if (next_man->fork() || next_man->tee()) {
         LOG_TRACE("+++ Do Not Combine: if next maneuver is a fork or a tee +++");
+        if (trace_) {
+          TraceCombine(TraceEvent::kNoCombineForkOrTee, *curr_man, *next_man);
+        }
         // Update with no combine
         prev_man = curr_man;
         curr_man = next_man;
@@ -325,6 +353,9 @@ void ManeuversBuilder::Combine(std::list<Maneuver>& maneuvers) {
       // if current or next maneuver is a ferry
       else if (curr_man->ferry() || next_man->ferry()) {
         LOG_TRACE("+++ Do Not Combine: if current or next maneuver is a ferry +++");
+        if (trace_) {
+          TraceCombine(TraceEvent::kNoCombineFerry, *curr_man, *next_man);
+        }
         // Update with no combine
         prev_man = curr_man;
         curr_man = next_man;
@@ -333,6 +364,9 @@ void ManeuversBuilder::Combine(std::list<Maneuver>& maneuvers) {
       // Combine current internal maneuver with next maneuver
       else if (curr_man->internal_intersection() && (curr_man != next_man)) {
         LOG_TRACE("+++ Combine: current internal maneuver with next maneuver +++");
+        if (trace_) {
+          TraceCombine(TraceEvent::kCombineInternal, *curr_man, *next_man);
+        }
         curr_man = CombineInternalManeuver(maneuvers, prev_man, curr_man,
                                            next_man,
                                            (curr_man == maneuvers.begin()));
@@ -343,6 +377,9 @@ void ManeuversBuilder::Combine(std::list<Maneuver>& maneuvers) {
       else if (IsTurnChannelManeuverCombinable(
           prev_man, curr_man, next_man, (curr_man == maneuvers.begin()))) {
         LOG_TRACE("+++ Combine: current turn channel maneuver with next maneuver +++");
+        if (trace_) {
+          TraceCombine(TraceEvent::kCombineTurnChannel, *curr_man, *next_man);
+        }
         curr_man = CombineTurnChannelManeuver(maneuvers, prev_man, curr_man,
                                               next_man,
                                               (curr_man == maneuvers.begin()));
@@ -353,6 +390,9 @@ void ManeuversBuilder::Combine(std::list<Maneuver>& maneuvers) {
       // if next maneuver has an intersecting forward link
       else if (next_man->intersecting_forward_edge()) {
         LOG_TRACE("+++ Do Not Combine: if next maneuver has an intersecting forward link +++");
+        if (trace_) {
+          TraceCombine(TraceEvent::kNoCombineIntersectingForwardEdge, *curr_man, *next_man);
+        }
         // Update with no combine
         prev_man = curr_man;
         curr_man = next_man;
@@ -364,6 +404,9 @@ void ManeuversBuilder::Combine(std::list<Maneuver>& maneuvers) {
           || (curr_man->unnamed_cycleway() != next_man->unnamed_cycleway())
           || (curr_man->unnamed_mountain_bike_trail() != next_man->unnamed_mountain_bike_trail())) {
         LOG_TRACE("+++ Do Not Combine: if travel type is different +++");
+        if (trace_) {
+          TraceCombine(TraceEvent::kNoCombineTravelType, *curr_man, *next_man);
+        }
         // Update with no combine
         prev_man = curr_man;
         curr_man = next_man;
@@ -387,6 +430,9 @@ void ManeuversBuilder::Combine(std::list<Maneuver>& maneuvers) {
           && !next_man->roundabout() && !common_base_names->empty()) {
 
         LOG_TRACE("+++ Combine: Several factors +++");
+        if (trace_) {
+          TraceCombine(TraceEvent::kCombineSameNameStraight, *curr_man, *next_man);
+        }
         // If needed, set the begin street names
         if (!curr_man->HasBeginStreetNames() && !curr_man->portions_highway()
             && (curr_man->street_names().size() > common_base_names->size())) {
@@ -412,11 +458,17 @@ void ManeuversBuilder::Combine(std::list<Maneuver>& maneuvers) {
           && !next_man->roundabout()) {
 
         LOG_TRACE("+++ Combine: unnamed straight maneuvers +++");
+        if (trace_) {
+          TraceCombine(TraceEvent::kCombineUnnamedStraight, *curr_man, *next_man);
+        }
         next_man = CombineSameNameStraightManeuver(maneuvers, curr_man,
                                                    next_man);
         maneuvers_have_been_combined = true;
       } else {
         LOG_TRACE("+++ Do Not Combine +++");
+        if (trace_) {
+          TraceCombine(TraceEvent::kNoCombine, *curr_man, *next_man);
+        }
         // Update with no combine
         prev_man = curr_man;
         curr_man = next_man;
@@ -517,7 +569,7 @@ std::list<Maneuver>::iterator ManeuversBuilder::CombineInternalManeuver(
   } else {
     // Set maneuver type to 'none' so the type will be processed again
     next_man->set_type(TripDirections_Maneuver_Type_kNone);
-    SetManeuverType(*(next_man));
+    SetManeuverType<MixedMode>(*(next_man));
   }
 
   return maneuvers.erase(curr_man);
@@ -563,7 +615,7 @@ std::list<Maneuver>::iterator ManeuversBuilder::CombineTurnChannelManeuver(
   } else {
     // Set maneuver type to 'none' so the type will be processed again
     next_man->set_type(TripDirections_Maneuver_Type_kNone);
-    SetManeuverType(*(next_man));
+    SetManeuverType<MixedMode>(*(next_man));
   }
 
   return maneuvers.erase(curr_man);
@@ -681,7 +733,7 @@ void ManeuversBuilder::ConfirmManeuverTypeAssignment(
     std::list<Maneuver>& maneuvers) {
 
   for (auto& maneuver : maneuvers) {
-    SetManeuverType(maneuver, false);
+    SetManeuverType<MixedMode>(maneuver, false);
   }
 }
 
@@ -741,11 +793,12 @@ void ManeuversBuilder::CreateDestinationManeuver(Maneuver& maneuver) {
 
   // Set the verbal text formatter
   maneuver.set_verbal_formatter(
-      VerbalTextFormatterFactory::Create(trip_path_->GetCountryCode(node_index),
-                                         trip_path_->GetStateCode(node_index)));
+      get_verbal_text_formatter(trip_path_->GetCountryCode(node_index),
+                                trip_path_->GetStateCode(node_index)));
 
 }
 
+template <class Mode>
 void ManeuversBuilder::CreateStartManeuver(Maneuver& maneuver) {
   int node_index = 0;
 
@@ -768,9 +821,10 @@ void ManeuversBuilder::CreateStartManeuver(Maneuver& maneuver) {
     }
   }
 
-  FinalizeManeuver(maneuver, node_index);
+  FinalizeManeuver<Mode>(maneuver, node_index);
 }
 
+template <class Mode>
 void ManeuversBuilder::InitializeManeuver(Maneuver& maneuver, int node_index) {
 
   auto* prev_edge = trip_path_->GetPrevEdge(node_index);
@@ -849,7 +903,8 @@ void ManeuversBuilder::InitializeManeuver(Maneuver& maneuver, int node_index) {
   maneuver.set_unnamed_mountain_bike_trail(prev_edge->IsUnnamedMountainBikeTrail());
 
   // Transit info
-  if (prev_edge->travel_mode() == TripPath_TravelMode_kTransit) {
+  if (Mode::kMixed
+      && (prev_edge->travel_mode() == TripPath_TravelMode_kTransit)) {
     maneuver.set_rail(prev_edge->IsRailUse());
     maneuver.set_bus(prev_edge->IsBusUse());
     auto* transit_info = maneuver.mutable_transit_info();
@@ -870,7 +925,7 @@ void ManeuversBuilder::InitializeManeuver(Maneuver& maneuver, int node_index) {
   }
 
   // Transit connection
-  if (prev_edge->IsTransitConnectionUse()) {
+  if (Mode::kMixed && prev_edge->IsTransitConnectionUse()) {
     maneuver.set_transit_connection(true);
     // If current edge is transit then mark maneuver as transit connection start
     if (curr_edge
@@ -879,15 +934,7 @@ void ManeuversBuilder::InitializeManeuver(Maneuver& maneuver, int node_index) {
       LOG_TRACE("ManeuverType=TRANSIT_CONNECTION_START");
       auto* node = trip_path_->GetEnhancedNode(node_index);
       maneuver.set_transit_connection_stop(
-          TransitStop(node->transit_stop_info().type(),
-                      node->transit_stop_info().onestop_id(),
-                      node->transit_stop_info().name(),
-                      node->transit_stop_info().arrival_date_time(),
-                      node->transit_stop_info().departure_date_time(),
-                      node->transit_stop_info().is_parent_stop(),
-                      node->transit_stop_info().assumed_schedule(),
-                      node->transit_stop_info().ll().lat(),
-                      node->transit_stop_info().ll().lng()));
+          TransitStop(node->transit_stop_info()));
     }
     // else mark it as transit connection destination
     else {
@@ -898,9 +945,10 @@ void ManeuversBuilder::InitializeManeuver(Maneuver& maneuver, int node_index) {
   }
 
   // TODO - what about street names; maybe check name flag
-  UpdateManeuver(maneuver, node_index);
+  UpdateManeuver<Mode>(maneuver, node_index);
 }
 
+template <class Mode>
 void ManeuversBuilder::UpdateManeuver(Maneuver& maneuver, int node_index) {
 
   auto* prev_edge = trip_path_->GetPrevEdge(node_index);
@@ -925,7 +973,8 @@ void ManeuversBuilder::UpdateManeuver(Maneuver& maneuver, int node_index) {
   // Basic time (len/speed on each edge with no stop impact) in seconds
   maneuver.set_basic_time(maneuver.basic_time()
           + GetTime(prev_edge->length(),
-                    GetSpeed(maneuver.travel_mode(), prev_edge->speed())));
+                    GetSpeed(Mode::TravelMode(maneuver.travel_mode()),
+                             prev_edge->speed())));
 
   // Portions Toll
   if (prev_edge->toll()) {
@@ -984,23 +1033,15 @@ void ManeuversBuilder::UpdateManeuver(Maneuver& maneuver, int node_index) {
   }
 
   // Insert transit stop into the transit maneuver
-  if (prev_edge->travel_mode() == TripPath_TravelMode_kTransit) {
+  if (Mode::kMixed
+      && (prev_edge->travel_mode() == TripPath_TravelMode_kTransit)) {
     auto* node = trip_path_->GetEnhancedNode(node_index);
-    maneuver.InsertTransitStop(
-        std::move(
-            TransitStop(node->transit_stop_info().type(),
-                        node->transit_stop_info().onestop_id(),
-                        node->transit_stop_info().name(),
-                        node->transit_stop_info().arrival_date_time(),
-                        node->transit_stop_info().departure_date_time(),
-                        node->transit_stop_info().is_parent_stop(),
-                        node->transit_stop_info().assumed_schedule(),
-                        node->transit_stop_info().ll().lat(),
-                        node->transit_stop_info().ll().lng())));
+    maneuver.InsertTransitStop(TransitStop(node->transit_stop_info()));
   }
 
 }
 
+template <class Mode>
 void ManeuversBuilder::FinalizeManeuver(Maneuver& maneuver, int node_index) {
 
   auto* prev_edge = trip_path_->GetPrevEdge(node_index);
@@ -1054,7 +1095,8 @@ void ManeuversBuilder::FinalizeManeuver(Maneuver& maneuver, int node_index) {
   }
 
   // Mark transit connection transfer
-  if ((maneuver.type() == TripDirections_Maneuver_Type_kTransitConnectionStart)
+  if (Mode::kMixed
+      && (maneuver.type() == TripDirections_Maneuver_Type_kTransitConnectionStart)
       && prev_edge
       && (prev_edge->travel_mode() == TripPath_TravelMode_kTransit)) {
     maneuver.set_type(TripDirections_Maneuver_Type_kTransitConnectionTransfer);
@@ -1063,36 +1105,20 @@ void ManeuversBuilder::FinalizeManeuver(Maneuver& maneuver, int node_index) {
 
 
   // Add transit connection stop to a transit connection destination
-  if ((maneuver.type() == TripDirections_Maneuver_Type_kTransitConnectionDestination)
+  if (Mode::kMixed
+      && (maneuver.type() == TripDirections_Maneuver_Type_kTransitConnectionDestination)
       && prev_edge
       && (prev_edge->travel_mode() == TripPath_TravelMode_kTransit)) {
     auto* node = trip_path_->GetEnhancedNode(node_index);
     maneuver.set_transit_connection_stop(
-        TransitStop(node->transit_stop_info().type(),
-                    node->transit_stop_info().onestop_id(),
-                    node->transit_stop_info().name(),
-                    node->transit_stop_info().arrival_date_time(),
-                    node->transit_stop_info().departure_date_time(),
-                    node->transit_stop_info().is_parent_stop(),
-                    node->transit_stop_info().assumed_schedule(),
-                    node->transit_stop_info().ll().lat(),
-                    node->transit_stop_info().ll().lng()));
+        TransitStop(node->transit_stop_info()));
   }
 
   // Insert first transit stop
-  if (maneuver.travel_mode() == TripPath_TravelMode_kTransit) {
+  if (Mode::kMixed
+      && (maneuver.travel_mode() == TripPath_TravelMode_kTransit)) {
     auto* node = trip_path_->GetEnhancedNode(node_index);
-    maneuver.InsertTransitStop(
-        std::move(
-            TransitStop(node->transit_stop_info().type(),
-                        node->transit_stop_info().onestop_id(),
-                        node->transit_stop_info().name(),
-                        node->transit_stop_info().arrival_date_time(),
-                        node->transit_stop_info().departure_date_time(),
-                        node->transit_stop_info().is_parent_stop(),
-                        node->transit_stop_info().assumed_schedule(),
-                        node->transit_stop_info().ll().lat(),
-                        node->transit_stop_info().ll().lng())));
+    maneuver.InsertTransitStop(TransitStop(node->transit_stop_info()));
   }
 
   // Set the begin intersecting edge name consistency
@@ -1113,14 +1139,15 @@ void ManeuversBuilder::FinalizeManeuver(Maneuver& maneuver, int node_index) {
 
   // Set the verbal text formatter
   maneuver.set_verbal_formatter(
-      VerbalTextFormatterFactory::Create(trip_path_->GetCountryCode(node_index),
-                                         trip_path_->GetStateCode(node_index)));
+      get_verbal_text_formatter(trip_path_->GetCountryCode(node_index),
+                                trip_path_->GetStateCode(node_index)));
 
   // Set the maneuver type
-  SetManeuverType(maneuver);
+  SetManeuverType<Mode>(maneuver);
 
 }
 
+template <class Mode>
 void ManeuversBuilder::SetManeuverType(Maneuver& maneuver, bool none_type_allowed) {
   // If the type is already set then just return
   if (maneuver.type() != TripDirections_Maneuver_Type_kNone) {
@@ -1131,7 +1158,8 @@ void ManeuversBuilder::SetManeuverType(Maneuver& maneuver, bool none_type_allowe
   auto* curr_edge = trip_path_->GetCurrEdge(maneuver.begin_node_index());
 
   // Process the different transit types
-  if (maneuver.travel_mode() == TripPath_TravelMode_kTransit) {
+  if (Mode::kMixed
+      && (maneuver.travel_mode() == TripPath_TravelMode_kTransit)) {
     if (prev_edge
         && prev_edge->travel_mode() == TripPath_TravelMode_kTransit) {
       // Process transit remain on
@@ -1154,7 +1182,7 @@ void ManeuversBuilder::SetManeuverType(Maneuver& maneuver, bool none_type_allowe
     }
   }
   // Process post transit connection destination
-  else if (prev_edge && prev_edge->IsTransitConnectionUse()
+  else if (Mode::kMixed && prev_edge && prev_edge->IsTransitConnectionUse()
       && (maneuver.travel_mode() != TripPath_TravelMode_kTransit)) {
     maneuver.set_type(
         TripDirections_Maneuver_Type_kPostTransitConnectionDestination);
@@ -1218,10 +1246,8 @@ void ManeuversBuilder::SetManeuverType(Maneuver& maneuver, bool none_type_allowe
         break;
       }
       default: {
-        LOG_INFO(
-            std::string("EXIT RelativeDirection=")
-                + std::to_string(
-                    static_cast<int>(maneuver.begin_relative_direction())));
+        ODIN_LOG(kInfo, kManeuvers).Field("exit_relative_direction",
+            static_cast<int>(maneuver.begin_relative_direction()));
         // TODO: determine how to handle, for now set to right
         maneuver.set_type(TripDirections_Maneuver_Type_kExitRight);
         LOG_TRACE("ManeuverType=EXIT_RIGHT");
@@ -1249,10 +1275,8 @@ void ManeuversBuilder::SetManeuverType(Maneuver& maneuver, bool none_type_allowe
         break;
       }
       default: {
-        LOG_INFO(
-            std::string("RAMP RelativeDirection=")
-                + std::to_string(
-                    static_cast<int>(maneuver.begin_relative_direction())));
+        ODIN_LOG(kInfo, kManeuvers).Field("ramp_relative_direction",
+            static_cast<int>(maneuver.begin_relative_direction()));
         // TODO: determine how to handle, for now set to right
         maneuver.set_type(TripDirections_Maneuver_Type_kRampRight);
         LOG_TRACE("ManeuverType=RAMP_RIGHT");
@@ -1451,6 +1475,7 @@ TripDirections_Maneuver_CardinalDirection ManeuversBuilder::DetermineCardinalDir
   throw valhalla_exception_t{400, 220};
 }
 
+template <class Mode>
 bool ManeuversBuilder::CanManeuverIncludePrevEdge(Maneuver& maneuver,
                                                   int node_index) {
   auto* prev_edge = trip_path_->GetPrevEdge(node_index);
@@ -1459,15 +1484,18 @@ bool ManeuversBuilder::CanManeuverIncludePrevEdge(Maneuver& maneuver,
 
   /////////////////////////////////////////////////////////////////////////////
   // Process transit
-  if ((maneuver.travel_mode() == TripPath_TravelMode_kTransit)
+  if (Mode::kMixed
+      && (maneuver.travel_mode() == TripPath_TravelMode_kTransit)
       && (prev_edge->travel_mode() != TripPath_TravelMode_kTransit)) {
     return false;
   }
-  if ((prev_edge->travel_mode() == TripPath_TravelMode_kTransit)
+  if (Mode::kMixed
+      && (prev_edge->travel_mode() == TripPath_TravelMode_kTransit)
       && (maneuver.travel_mode() != TripPath_TravelMode_kTransit)) {
     return false;
   }
-  if ((maneuver.travel_mode() == TripPath_TravelMode_kTransit)
+  if (Mode::kMixed
+      && (maneuver.travel_mode() == TripPath_TravelMode_kTransit)
       && (prev_edge->travel_mode() == TripPath_TravelMode_kTransit)) {
 
     // Both block id and trip id must be the same so we can combine...
@@ -1484,18 +1512,21 @@ bool ManeuversBuilder::CanManeuverIncludePrevEdge(Maneuver& maneuver,
 
   /////////////////////////////////////////////////////////////////////////////
   // Process transit connection
-  if (maneuver.transit_connection() && prev_edge->IsTransitConnectionUse()
+  if (Mode::kMixed
+      && maneuver.transit_connection() && prev_edge->IsTransitConnectionUse()
       && !(maneuver.transit_connection_stop().name.empty())
       && (maneuver.transit_connection_stop().name
           == prev_node->transit_stop_info().name())) {
     return true;
-  } else if (maneuver.transit_connection() || prev_edge->IsTransitConnectionUse()) {
+  } else if (Mode::kMixed && (maneuver.transit_connection()
+      || prev_edge->IsTransitConnectionUse())) {
     return false;
   }
 
   /////////////////////////////////////////////////////////////////////////////
   // Process travel mode and travel types (unnamed pedestrian and bike)
-  if (maneuver.travel_mode() != prev_edge->travel_mode()) {
+  // The unnamed types depend on the use of the edges, not their travel mode
+  if (Mode::kMixed && (maneuver.travel_mode() != prev_edge->travel_mode())) {
     return false;
   }
   if (maneuver.unnamed_walkway() != prev_edge->IsUnnamedWalkway()) {
@@ -2084,5 +2115,60 @@ void ManeuversBuilder::EnhanceSignlessInterchnages(
 
 }
 
+void ManeuversBuilder::TraceNode(int node_index) {
+  auto* prev_edge = trip_path_->GetPrevEdge(node_index);
+  auto* curr_edge = trip_path_->GetCurrEdge(node_index);
+  auto* node = trip_path_->GetEnhancedNode(node_index);
+
+  int32_t turn_degree = (prev_edge && curr_edge) ?
+      GetTurnDegree(prev_edge->end_heading(), curr_edge->begin_heading()) : 0;
+  trace_->Add(TraceEvent::kNode, 0, node_index, turn_degree,
+              node->intersecting_edge_size(),
+              (curr_edge ? curr_edge->begin_heading() : 0),
+              (prev_edge ? prev_edge->end_heading() : 0));
+
+  for (size_t z = 0; z < node->intersecting_edge_size(); ++z) {
+    auto* intersecting_edge = node->GetIntersectingEdge(z);
+    trace_->Add(TraceEvent::kIntersectingEdge, z, node_index,
+                intersecting_edge->begin_heading(),
+                (prev_edge ? GetTurnDegree(prev_edge->end_heading(),
+                    intersecting_edge->begin_heading()) : 0),
+                intersecting_edge->driveability(),
+                intersecting_edge->walkability());
+  }
+
+  if (prev_edge) {
+    IntersectingEdgeCounts xedge_counts;
+    node->CalculateRightLeftIntersectingEdgeCounts(prev_edge->end_heading(),
+                                                   prev_edge->travel_mode(),
+                                                   xedge_counts);
+    trace_->Add(TraceEvent::kRightXEdgeCounts, 0, node_index,
+                xedge_counts.right, xedge_counts.right_similar,
+                xedge_counts.right_traversable_outbound,
+                xedge_counts.right_similar_traversable_outbound);
+    trace_->Add(TraceEvent::kLeftXEdgeCounts, 0, node_index,
+                xedge_counts.left, xedge_counts.left_similar,
+                xedge_counts.left_traversable_outbound,
+                xedge_counts.left_similar_traversable_outbound);
+  }
+}
+
+void ManeuversBuilder::TraceManeuvers(const std::list<Maneuver>& maneuvers,
+                                      TraceEvent::Type type) {
+  for (const Maneuver& maneuver : maneuvers) {
+    trace_->Add(type, maneuver.type(), maneuver.begin_node_index(),
+                maneuver.end_node_index(),
+                static_cast<int32_t>(maneuver.length() * 1000.0f),
+                maneuver.street_names().size(), maneuver.turn_degree());
+  }
+}
+
+void ManeuversBuilder::TraceCombine(TraceEvent::CombineDecision decision,
+                                    const Maneuver& curr_man,
+                                    const Maneuver& next_man) {
+  trace_->Add(TraceEvent::kCombine, decision, curr_man.begin_node_index(),
+              next_man.begin_node_index());
+}
+
 }
 }
@@ -1,13 +1,17 @@
 #include <stdexcept>
 
 #include <boost/property_tree/ptree.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
 
 #include <valhalla/midgard/logging.h>
 
 #include "odin/narrative_dictionary.h"
+#include "odin/util.h"
 
 namespace {
 
+constexpr uint32_t kMinutesPerDay = 24 * 60;
+
 // Read array and return as a vector
 template<typename T>
 std::vector<T> as_vector(boost::property_tree::ptree const& pt,
@@ -56,6 +60,18 @@ void NarrativeDictionary::Load(
   catch (std::runtime_error& rte) {
     LOG_TRACE("Using the default locale because a locale was not found for: " + posix_locale);
   }
+  number_formatter = NumberFormatter(locale);
+
+  // Populate date_locale and localized_times, times only depend on the
+  // minute of the day so every one is formatted up front
+  date_locale = std::locale(locale, new boost::posix_time::time_facet("%x"));
+  std::locale time_locale(locale, new boost::posix_time::time_facet("%X"));
+  boost::posix_time::ptime midnight(boost::gregorian::date(2000, 1, 1));
+  localized_times.reserve(kMinutesPerDay);
+  for (uint32_t minute = 0; minute < kMinutesPerDay; ++minute) {
+    localized_times.emplace_back(format_localized_time(
+        midnight + boost::posix_time::minutes(minute), time_locale));
+  }
 
   /////////////////////////////////////////////////////////////////////////////
   LOG_TRACE("Populate start_subset...");
@@ -362,6 +378,11 @@ void NarrativeDictionary::Load(
   // Populate us_customary_lengths
   start_verbal_handle.us_customary_lengths = as_vector<std::string>(
       start_verbal_subset_pt, kUsCustomaryLengthsKey);
+
+  // Populate length_phrases
+  start_verbal_handle.length_phrases = LengthPhraseTable(
+      start_verbal_handle.metric_lengths,
+      start_verbal_handle.us_customary_lengths, number_formatter);
 }
 
 void NarrativeDictionary::Load(
@@ -402,6 +423,11 @@ void NarrativeDictionary::Load(
   // Populate us_customary_lengths
   continue_verbal_handle.us_customary_lengths = as_vector<std::string>(
       continue_verbal_subset_pt, kUsCustomaryLengthsKey);
+
+  // Populate length_phrases
+  continue_verbal_handle.length_phrases = LengthPhraseTable(
+      continue_verbal_handle.metric_lengths,
+      continue_verbal_handle.us_customary_lengths, number_formatter);
 }
 
 void NarrativeDictionary::Load(
@@ -531,6 +557,11 @@ void NarrativeDictionary::Load(
   post_transition_verbal_handle.us_customary_lengths = as_vector<std::string>(
       post_transition_verbal_subset_pt, kUsCustomaryLengthsKey);
 
+  // Populate length_phrases
+  post_transition_verbal_handle.length_phrases = LengthPhraseTable(
+      post_transition_verbal_handle.metric_lengths,
+      post_transition_verbal_handle.us_customary_lengths, number_formatter);
+
   // Populate empty_street_name_labels
   post_transition_verbal_handle.empty_street_name_labels = as_vector<std::string>(
       post_transition_verbal_subset_pt, kEmptyStreetNameLabelsKey);
@@ -555,6 +586,19 @@ const std::locale& NarrativeDictionary::GetLocale() const {
   return locale;
 }
 
+const NumberFormatter& NarrativeDictionary::GetNumberFormatter() const {
+  return number_formatter;
+}
+
+const std::locale& NarrativeDictionary::GetDateLocale() const {
+  return date_locale;
+}
+
+const std::string& NarrativeDictionary::GetLocalizedTime(
+    uint32_t minute_of_day) const {
+  return localized_times.at(minute_of_day);
+}
+
 const std::string& NarrativeDictionary::GetLanguageTag() const {
   return language_tag;
 }
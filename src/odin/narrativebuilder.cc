@@ -1,5 +1,3 @@
-#include <sstream>
-#include <iomanip>
 #include <cmath>
 #include <string>
 
@@ -19,12 +17,6 @@
 #include "config.h"
 
 namespace {
-// Text instruction initial capacity
-constexpr auto kInstructionInitialCapacity = 128;
-
-// Text length initial capacity
-constexpr auto kLengthStringInitialCapacity = 32;
-
 // Basic time threshold in seconds for creating a verbal multi-cue
 constexpr auto kVerbalMultiCueTimeThreshold = 10;
 
@@ -544,7 +536,6 @@ std::string NarrativeBuilder::FormStartInstruction(Maneuver& maneuver) {
   // "18": "Bike <CARDINAL_DIRECTION> on <BEGIN_STREET_NAMES>. Continue on <STREET_NAMES>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Set cardinal_direction value
   std::string cardinal_direction = dictionary_.start_subset.cardinal_directions
@@ -575,13 +566,11 @@ std::string NarrativeBuilder::FormStartInstruction(Maneuver& maneuver) {
     phrase_id += 16;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.start_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kCardinalDirectionTag, cardinal_direction);
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
-  boost::replace_all(instruction, kBeginStreetNamesTag, begin_street_names);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.start_subset, phrase_id, {
+      { kCardinalDirectionTag, cardinal_direction },
+      { kStreetNamesTag, street_names },
+      { kBeginStreetNamesTag, begin_street_names } });
 
   return instruction;
 }
@@ -593,7 +582,6 @@ std::string NarrativeBuilder::FormVerbalStartInstruction(
   // "2": "Head <CARDINAL_DIRECTION> on <BEGIN_STREET_NAMES>.",
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Set cardinal_direction value
   std::string cardinal_direction = dictionary_.start_verbal_subset
@@ -627,17 +615,13 @@ std::string NarrativeBuilder::FormVerbalStartInstruction(
     phrase_id += 16;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.start_verbal_subset.phrases.at(
-      std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kCardinalDirectionTag, cardinal_direction);
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
-  boost::replace_all(instruction, kBeginStreetNamesTag, begin_street_names);
-  boost::replace_all(instruction, kLengthTag,
-      FormLength(maneuver, dictionary_.start_verbal_subset.metric_lengths,
-                 dictionary_.start_verbal_subset.us_customary_lengths));
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.start_verbal_subset, phrase_id, {
+      { kCardinalDirectionTag, cardinal_direction },
+      { kStreetNamesTag, street_names },
+      { kBeginStreetNamesTag, begin_street_names },
+      { kLengthTag,
+        FormLength(maneuver, dictionary_.start_verbal_subset.length_phrases) } });
 
   return instruction;
 }
@@ -650,7 +634,6 @@ std::string NarrativeBuilder::FormDestinationInstruction(Maneuver& maneuver) {
 
   uint8_t phrase_id = 0;
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Determine if location (name or street) exists
   std::string destination;
@@ -676,15 +659,10 @@ std::string NarrativeBuilder::FormDestinationInstruction(Maneuver& maneuver) {
     relative_direction = dictionary_.destination_subset.relative_directions.at(1);
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.destination_subset.phrases.at(
-      std::to_string(phrase_id));
-
-  if (phrase_id > 0) {
-    // Replace phrase tags with values
-    boost::replace_all(instruction, kRelativeDirectionTag, relative_direction);
-    boost::replace_all(instruction, kDestinationTag, destination);
-  }
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.destination_subset, phrase_id, {
+      { kRelativeDirectionTag, relative_direction },
+      { kDestinationTag, destination } });
 
   return instruction;
 }
@@ -698,7 +676,6 @@ std::string NarrativeBuilder::FormVerbalAlertDestinationInstruction(
 
   uint8_t phrase_id = 0;
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Determine if destination (name or street) exists
   std::string destination;
@@ -728,15 +705,10 @@ std::string NarrativeBuilder::FormVerbalAlertDestinationInstruction(
     relative_direction = dictionary_.destination_subset.relative_directions.at(1);
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.destination_verbal_alert_subset.phrases.at(
-      std::to_string(phrase_id));
-
-  if (phrase_id > 0) {
-    // Replace phrase tags with values
-    boost::replace_all(instruction, kRelativeDirectionTag, relative_direction);
-    boost::replace_all(instruction, kDestinationTag, destination);
-  }
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.destination_verbal_alert_subset, phrase_id, {
+      { kRelativeDirectionTag, relative_direction },
+      { kDestinationTag, destination } });
 
   return instruction;
 }
@@ -750,7 +722,6 @@ std::string NarrativeBuilder::FormVerbalDestinationInstruction(
 
   uint8_t phrase_id = 0;
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Determine if destination (name or street) exists
   std::string destination;
@@ -780,15 +751,10 @@ std::string NarrativeBuilder::FormVerbalDestinationInstruction(
     relative_direction = dictionary_.destination_subset.relative_directions.at(1);
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.destination_verbal_subset.phrases.at(
-      std::to_string(phrase_id));
-
-  if (phrase_id > 0) {
-    // Replace phrase tags with values
-    boost::replace_all(instruction, kRelativeDirectionTag, relative_direction);
-    boost::replace_all(instruction, kDestinationTag, destination);
-  }
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.destination_verbal_subset, phrase_id, {
+      { kRelativeDirectionTag, relative_direction },
+      { kDestinationTag, destination } });
 
   return instruction;
 }
@@ -798,7 +764,6 @@ std::string NarrativeBuilder::FormBecomesInstruction(Maneuver& maneuver,
   // "0": "<PREVIOUS_STREET_NAMES> becomes <STREET_NAMES>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign the street names and the previous maneuver street names
   std::string street_names = FormStreetNames(maneuver, maneuver.street_names());
@@ -808,12 +773,10 @@ std::string NarrativeBuilder::FormBecomesInstruction(Maneuver& maneuver,
   // Determine which phrase to use
   uint8_t phrase_id = 0;
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.becomes_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kPreviousStreetNamesTag, prev_street_names);
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.becomes_subset, phrase_id, {
+      { kPreviousStreetNamesTag, prev_street_names },
+      { kStreetNamesTag, street_names } });
 
   return instruction;
 
@@ -825,7 +788,6 @@ std::string NarrativeBuilder::FormVerbalBecomesInstruction(
   // "0": "<PREVIOUS_STREET_NAMES> becomes <STREET_NAMES>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign the street names and the previous maneuver street names
   std::string street_names = FormStreetNames(maneuver, maneuver.street_names(),
@@ -839,12 +801,10 @@ std::string NarrativeBuilder::FormVerbalBecomesInstruction(
   // Determine which phrase to use
   uint8_t phrase_id = 0;
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.becomes_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kPreviousStreetNamesTag, prev_street_names);
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.becomes_verbal_subset, phrase_id, {
+      { kPreviousStreetNamesTag, prev_street_names },
+      { kStreetNamesTag, street_names } });
 
   return instruction;
 
@@ -855,7 +815,6 @@ std::string NarrativeBuilder::FormContinueInstruction(Maneuver& maneuver) {
   // "1": "Continue on <STREET_NAMES>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign the street names
   std::string street_names = FormStreetNames(
@@ -868,12 +827,9 @@ std::string NarrativeBuilder::FormContinueInstruction(Maneuver& maneuver) {
     phrase_id = 1;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.continue_subset.phrases.at(
-      std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.continue_subset, phrase_id, {
+      { kStreetNamesTag, street_names } });
 
   return instruction;
 }
@@ -884,7 +840,6 @@ std::string NarrativeBuilder::FormVerbalAlertContinueInstruction(
   // "1": "Continue on <STREET_NAMES>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign the street names
   std::string street_names = FormStreetNames(
@@ -898,12 +853,9 @@ std::string NarrativeBuilder::FormVerbalAlertContinueInstruction(
     phrase_id = 1;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.continue_verbal_alert_subset.phrases.at(
-      std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.continue_verbal_alert_subset, phrase_id, {
+      { kStreetNamesTag, street_names } });
 
   return instruction;
 }
@@ -915,7 +867,6 @@ std::string NarrativeBuilder::FormVerbalContinueInstruction(
   // "1": "Continue on <STREET_NAMES> for <LENGTH>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign the street names
   std::string street_names = FormStreetNames(
@@ -929,15 +880,11 @@ std::string NarrativeBuilder::FormVerbalContinueInstruction(
     phrase_id = 1;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.continue_verbal_subset.phrases.at(
-      std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kLengthTag,
-      FormLength(maneuver, dictionary_.continue_verbal_subset.metric_lengths,
-                 dictionary_.continue_verbal_subset.us_customary_lengths));
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.continue_verbal_subset, phrase_id, {
+      { kLengthTag,
+        FormLength(maneuver, dictionary_.continue_verbal_subset.length_phrases) },
+      { kStreetNamesTag, street_names } });
 
   return instruction;
 }
@@ -967,7 +914,6 @@ std::string NarrativeBuilder::FormTurnInstruction(Maneuver& maneuver,
   }
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign the street names
   std::string street_names = FormStreetNames(
@@ -991,14 +937,12 @@ std::string NarrativeBuilder::FormTurnInstruction(Maneuver& maneuver,
     phrase_id = 3;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = subset->phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kRelativeDirectionTag,
-      FormRelativeTwoDirection(maneuver.type(), subset->relative_directions));
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
-  boost::replace_all(instruction, kBeginStreetNamesTag, begin_street_names);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(*subset, phrase_id, {
+      { kRelativeDirectionTag,
+        FormRelativeTwoDirection(maneuver.type(), subset->relative_directions) },
+      { kStreetNamesTag, street_names },
+      { kBeginStreetNamesTag, begin_street_names } });
 
   return instruction;
 
@@ -1043,7 +987,6 @@ std::string NarrativeBuilder::FormVerbalTurnInstruction(
   }
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign the street names
   std::string street_names = FormStreetNames(
@@ -1070,15 +1013,12 @@ std::string NarrativeBuilder::FormVerbalTurnInstruction(
     phrase_id = 3;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = subset->phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kRelativeDirectionTag,
-      FormRelativeTwoDirection(
-          maneuver.type(), subset->relative_directions));
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
-  boost::replace_all(instruction, kBeginStreetNamesTag, begin_street_names);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(*subset, phrase_id, {
+      { kRelativeDirectionTag,
+        FormRelativeTwoDirection(maneuver.type(), subset->relative_directions) },
+      { kStreetNamesTag, street_names },
+      { kBeginStreetNamesTag, begin_street_names } });
 
   return instruction;
 }
@@ -1093,7 +1033,6 @@ std::string NarrativeBuilder::FormUturnInstruction(Maneuver& maneuver,
   // "5": "Make a <RELATIVE_DIRECTION> U-turn at <CROSS_STREET_NAMES> to stay on <STREET_NAMES>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign the street names
   std::string street_names = FormStreetNames(
@@ -1116,15 +1055,12 @@ std::string NarrativeBuilder::FormUturnInstruction(Maneuver& maneuver,
     phrase_id += 3;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.uturn_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kRelativeDirectionTag,
-      FormRelativeTwoDirection(maneuver.type(),
-                               dictionary_.uturn_subset.relative_directions));
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
-  boost::replace_all(instruction, kCrossStreetNamesTag, cross_street_names);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.uturn_subset, phrase_id, {
+      { kRelativeDirectionTag,
+        FormRelativeTwoDirection(maneuver.type(), dictionary_.uturn_subset.relative_directions) },
+      { kStreetNamesTag, street_names },
+      { kCrossStreetNamesTag, cross_street_names } });
 
   return instruction;
 
@@ -1138,9 +1074,6 @@ std::string NarrativeBuilder::FormVerbalAlertUturnInstruction(
   // "2": "Make a <RELATIVE_DIRECTION> U-turn to stay on <STREET_NAMES>.",
   // "3": "Make a <RELATIVE_DIRECTION> U-turn at <CROSS_STREET_NAMES>."
 
-  std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
-
   // Assign the street names
   std::string street_names = FormStreetNames(
       maneuver, maneuver.street_names(),
@@ -1220,16 +1153,12 @@ std::string NarrativeBuilder::FormVerbalUturnInstruction(
     const std::string& street_names, const std::string& cross_street_names) {
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.uturn_verbal_subset.phrases.at(
-      std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kRelativeDirectionTag, relative_dir);
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
-  boost::replace_all(instruction, kCrossStreetNamesTag, cross_street_names);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.uturn_verbal_subset, phrase_id, {
+      { kRelativeDirectionTag, relative_dir },
+      { kStreetNamesTag, street_names },
+      { kCrossStreetNamesTag, cross_street_names } });
 
   return instruction;
 
@@ -1245,7 +1174,6 @@ std::string NarrativeBuilder::FormVerbalUturnInstruction(
   // "4": "Stay straight to take the <NAME_SIGN> ramp."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Determine which phrase to use
   uint8_t phrase_id = 0;
@@ -1272,14 +1200,11 @@ std::string NarrativeBuilder::FormVerbalUturnInstruction(
         element_max_count, limit_by_consecutive_count);
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.ramp_straight_subset.phrases.at(
-      std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kBranchSignTag, exit_branch_sign);
-  boost::replace_all(instruction, kTowardSignTag, exit_toward_sign);
-  boost::replace_all(instruction, kNameSignTag, exit_name_sign);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.ramp_straight_subset, phrase_id, {
+      { kBranchSignTag, exit_branch_sign },
+      { kTowardSignTag, exit_toward_sign },
+      { kNameSignTag, exit_name_sign } });
 
   return instruction;
 
@@ -1293,9 +1218,6 @@ std::string NarrativeBuilder::FormVerbalAlertRampStraightInstruction(
   // "2": "Stay straight to take the ramp toward <TOWARD_SIGN>.",
   // "4": "Stay straight to take the <NAME_SIGN> ramp."
 
-  std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
-
   // Determine which phrase to use
   uint8_t phrase_id = 0;
   std::string exit_branch_sign;
@@ -1372,16 +1294,12 @@ std::string NarrativeBuilder::FormVerbalRampStraightInstruction(
     const std::string& exit_toward_sign, const std::string& exit_name_sign) {
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
-
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.ramp_straight_verbal_subset.phrases.at(
-      std::to_string(phrase_id));
 
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kBranchSignTag, exit_branch_sign);
-  boost::replace_all(instruction, kTowardSignTag, exit_toward_sign);
-  boost::replace_all(instruction, kNameSignTag, exit_name_sign);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.ramp_straight_verbal_subset, phrase_id, {
+      { kBranchSignTag, exit_branch_sign },
+      { kTowardSignTag, exit_toward_sign },
+      { kNameSignTag, exit_name_sign } });
 
   return instruction;
 
@@ -1402,7 +1320,6 @@ std::string NarrativeBuilder::FormRampInstruction(
   // "9": "Turn <RELATIVE_DIRECTION> to take the <NAME_SIGN> ramp."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Determine which phrase to use
   uint8_t phrase_id = 0;
@@ -1435,16 +1352,13 @@ std::string NarrativeBuilder::FormRampInstruction(
         element_max_count, limit_by_consecutive_count);
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.ramp_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kRelativeDirectionTag,
-      FormRelativeTwoDirection(maneuver.type(),
-                               dictionary_.ramp_subset.relative_directions));
-  boost::replace_all(instruction, kBranchSignTag, exit_branch_sign);
-  boost::replace_all(instruction, kTowardSignTag, exit_toward_sign);
-  boost::replace_all(instruction, kNameSignTag, exit_name_sign);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.ramp_subset, phrase_id, {
+      { kRelativeDirectionTag,
+        FormRelativeTwoDirection(maneuver.type(), dictionary_.ramp_subset.relative_directions) },
+      { kBranchSignTag, exit_branch_sign },
+      { kTowardSignTag, exit_toward_sign },
+      { kNameSignTag, exit_name_sign } });
 
   return instruction;
 
@@ -1561,16 +1475,13 @@ std::string NarrativeBuilder::FormVerbalRampInstruction(
     const std::string& exit_name_sign) {
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.ramp_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kRelativeDirectionTag, relative_dir);
-  boost::replace_all(instruction, kBranchSignTag, exit_branch_sign);
-  boost::replace_all(instruction, kTowardSignTag, exit_toward_sign);
-  boost::replace_all(instruction, kNameSignTag, exit_name_sign);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.ramp_verbal_subset, phrase_id, {
+      { kRelativeDirectionTag, relative_dir },
+      { kBranchSignTag, exit_branch_sign },
+      { kTowardSignTag, exit_toward_sign },
+      { kNameSignTag, exit_name_sign } });
 
   return instruction;
 
@@ -1593,7 +1504,6 @@ std::string NarrativeBuilder::FormExitInstruction(
   // "14": "Take the <NAME_SIGN> exit on the <RELATIVE_DIRECTION> onto <BRANCH_SIGN> toward <TOWARD_SIGN>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Determine which phrase to use
   uint8_t phrase_id = 0;
@@ -1625,17 +1535,14 @@ std::string NarrativeBuilder::FormExitInstruction(
         element_max_count, limit_by_consecutive_count);
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.exit_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kRelativeDirectionTag,
-      FormRelativeTwoDirection(maneuver.type(),
-                               dictionary_.exit_subset.relative_directions));
-  boost::replace_all(instruction, kNumberSignTag, exit_number_sign);
-  boost::replace_all(instruction, kBranchSignTag, exit_branch_sign);
-  boost::replace_all(instruction, kTowardSignTag, exit_toward_sign);
-  boost::replace_all(instruction, kNameSignTag, exit_name_sign);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.exit_subset, phrase_id, {
+      { kRelativeDirectionTag,
+        FormRelativeTwoDirection(maneuver.type(), dictionary_.exit_subset.relative_directions) },
+      { kNumberSignTag, exit_number_sign },
+      { kBranchSignTag, exit_branch_sign },
+      { kTowardSignTag, exit_toward_sign },
+      { kNameSignTag, exit_name_sign } });
 
   return instruction;
 
@@ -1751,17 +1658,14 @@ std::string NarrativeBuilder::FormVerbalExitInstruction(
     const std::string& exit_toward_sign, const std::string& exit_name_sign) {
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.exit_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kRelativeDirectionTag, relative_dir);
-  boost::replace_all(instruction, kNumberSignTag, exit_number_sign);
-  boost::replace_all(instruction, kBranchSignTag, exit_branch_sign);
-  boost::replace_all(instruction, kTowardSignTag, exit_toward_sign);
-  boost::replace_all(instruction, kNameSignTag, exit_name_sign);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.exit_verbal_subset, phrase_id, {
+      { kRelativeDirectionTag, relative_dir },
+      { kNumberSignTag, exit_number_sign },
+      { kBranchSignTag, exit_branch_sign },
+      { kTowardSignTag, exit_toward_sign },
+      { kNameSignTag, exit_name_sign } });
 
   return instruction;
 }
@@ -1779,7 +1683,6 @@ std::string NarrativeBuilder::FormKeepInstruction(
   // "7": "Keep <RELATIVE_DIRECTION> to take exit <NUMBER_SIGN> onto <STREET_NAMES> toward <TOWARD_SIGN>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign the street names
   std::string street_names = FormStreetNames(
@@ -1812,16 +1715,13 @@ std::string NarrativeBuilder::FormKeepInstruction(
         element_max_count, limit_by_consecutive_count);
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.keep_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kRelativeDirectionTag,
-      FormRelativeThreeDirection(maneuver.type(),
-                                 dictionary_.keep_subset.relative_directions));
-  boost::replace_all(instruction, kNumberSignTag, exit_number_sign);
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
-  boost::replace_all(instruction, kTowardSignTag, exit_toward_sign);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.keep_subset, phrase_id, {
+      { kRelativeDirectionTag,
+        FormRelativeThreeDirection(maneuver.type(), dictionary_.keep_subset.relative_directions) },
+      { kNumberSignTag, exit_number_sign },
+      { kStreetNamesTag, street_names },
+      { kTowardSignTag, exit_toward_sign } });
 
   return instruction;
 
@@ -1937,16 +1837,13 @@ std::string NarrativeBuilder::FormVerbalKeepInstruction(
     const std::string& exit_toward_sign) {
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.keep_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kRelativeDirectionTag, relative_dir);
-  boost::replace_all(instruction, kNumberSignTag, exit_number_sign);
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
-  boost::replace_all(instruction, kTowardSignTag, exit_toward_sign);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.keep_verbal_subset, phrase_id, {
+      { kRelativeDirectionTag, relative_dir },
+      { kNumberSignTag, exit_number_sign },
+      { kStreetNamesTag, street_names },
+      { kTowardSignTag, exit_toward_sign } });
 
   return instruction;
 
@@ -1962,7 +1859,6 @@ std::string NarrativeBuilder::FormKeepToStayOnInstruction(
   // "3": "Keep <RELATIVE_DIRECTION> to take exit <NUMBER_SIGN> to stay on <STREET_NAMES> toward <TOWARD_SIGN>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign the street names
   std::string street_names = FormStreetNames(
@@ -1985,16 +1881,13 @@ std::string NarrativeBuilder::FormKeepToStayOnInstruction(
         element_max_count, limit_by_consecutive_count);
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.keep_to_stay_on_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kRelativeDirectionTag,
-      FormRelativeThreeDirection(maneuver.type(),
-                                 dictionary_.keep_to_stay_on_subset.relative_directions));
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
-  boost::replace_all(instruction, kNumberSignTag, exit_number_sign);
-  boost::replace_all(instruction, kTowardSignTag, exit_toward_sign);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.keep_to_stay_on_subset, phrase_id, {
+      { kRelativeDirectionTag,
+        FormRelativeThreeDirection(maneuver.type(), dictionary_.keep_to_stay_on_subset.relative_directions) },
+      { kStreetNamesTag, street_names },
+      { kNumberSignTag, exit_number_sign },
+      { kTowardSignTag, exit_toward_sign } });
 
   return instruction;
 
@@ -2067,17 +1960,13 @@ std::string NarrativeBuilder::FormVerbalKeepToStayOnInstruction(
       const std::string& exit_toward_sign) {
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
-
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.keep_to_stay_on_verbal_subset.phrases.at(
-      std::to_string(phrase_id));
 
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kRelativeDirectionTag, relative_dir);
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
-  boost::replace_all(instruction, kNumberSignTag, exit_number_sign);
-  boost::replace_all(instruction, kTowardSignTag, exit_toward_sign);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.keep_to_stay_on_verbal_subset, phrase_id, {
+      { kRelativeDirectionTag, relative_dir },
+      { kStreetNamesTag, street_names },
+      { kNumberSignTag, exit_number_sign },
+      { kTowardSignTag, exit_toward_sign } });
 
   return instruction;
 
@@ -2088,7 +1977,6 @@ std::string NarrativeBuilder::FormMergeInstruction(Maneuver& maneuver) {
   // "1": "Merge onto <STREET_NAMES>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign the street names
   std::string street_names = FormStreetNames(
@@ -2101,11 +1989,9 @@ std::string NarrativeBuilder::FormMergeInstruction(Maneuver& maneuver) {
     phrase_id = 1;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.merge_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.merge_subset, phrase_id, {
+      { kStreetNamesTag, street_names } });
 
   return instruction;
 }
@@ -2124,7 +2010,6 @@ std::string NarrativeBuilder::FormVerbalMergeInstruction(
   // "1": "Merge onto <STREET_NAMES>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign the street names
   std::string street_names = FormStreetNames(
@@ -2138,12 +2023,9 @@ std::string NarrativeBuilder::FormVerbalMergeInstruction(
     phrase_id = 1;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.merge_verbal_subset.phrases.at(
-      std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.merge_verbal_subset, phrase_id, {
+      { kStreetNamesTag, street_names } });
 
   return instruction;
 
@@ -2154,7 +2036,6 @@ std::string NarrativeBuilder::FormEnterRoundaboutInstruction(Maneuver& maneuver)
   // "1": "Enter the roundabout and take the <ORDINAL_VALUE> exit."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Determine which phrase to use
   uint8_t phrase_id = 0;
@@ -2167,11 +2048,9 @@ std::string NarrativeBuilder::FormEnterRoundaboutInstruction(Maneuver& maneuver)
         maneuver.roundabout_exit_count()-1);
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.enter_roundabout_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kOrdinalValueTag, ordinal_value);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.enter_roundabout_subset, phrase_id, {
+      { kOrdinalValueTag, ordinal_value } });
 
   return instruction;
 
@@ -2183,7 +2062,6 @@ std::string NarrativeBuilder::FormVerbalAlertEnterRoundaboutInstruction(
   // "1": "Enter the roundabout and take the <ORDINAL_VALUE> exit."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Determine which phrase to use
   uint8_t phrase_id = 0;
@@ -2196,11 +2074,9 @@ std::string NarrativeBuilder::FormVerbalAlertEnterRoundaboutInstruction(
         maneuver.roundabout_exit_count()-1);
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.enter_roundabout_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kOrdinalValueTag, ordinal_value);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.enter_roundabout_verbal_subset, phrase_id, {
+      { kOrdinalValueTag, ordinal_value } });
 
   return instruction;
 
@@ -2212,7 +2088,6 @@ std::string NarrativeBuilder::FormVerbalEnterRoundaboutInstruction(
   // "1": "Enter the roundabout and take the <ORDINAL_VALUE> exit."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Determine which phrase to use
   uint8_t phrase_id = 0;
@@ -2225,11 +2100,9 @@ std::string NarrativeBuilder::FormVerbalEnterRoundaboutInstruction(
         maneuver.roundabout_exit_count()-1);
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.enter_roundabout_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kOrdinalValueTag, ordinal_value);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.enter_roundabout_verbal_subset, phrase_id, {
+      { kOrdinalValueTag, ordinal_value } });
 
   return instruction;
 
@@ -2241,7 +2114,6 @@ std::string NarrativeBuilder::FormExitRoundaboutInstruction(Maneuver& maneuver)
   // "2": "Exit the roundabout onto <BEGIN_STREET_NAMES>. Continue on <STREET_NAMES>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign the street names
   std::string street_names = FormStreetNames(
@@ -2261,12 +2133,10 @@ std::string NarrativeBuilder::FormExitRoundaboutInstruction(Maneuver& maneuver)
     phrase_id = 1;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.exit_roundabout_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
-  boost::replace_all(instruction, kBeginStreetNamesTag, begin_street_names);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.exit_roundabout_subset, phrase_id, {
+      { kStreetNamesTag, street_names },
+      { kBeginStreetNamesTag, begin_street_names } });
 
   return instruction;
 
@@ -2279,7 +2149,6 @@ std::string NarrativeBuilder::FormVerbalExitRoundaboutInstruction(
   // "2": "Exit the roundabout onto <BEGIN_STREET_NAMES>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign the street names
   std::string street_names = FormStreetNames(
@@ -2301,12 +2170,10 @@ std::string NarrativeBuilder::FormVerbalExitRoundaboutInstruction(
     phrase_id = 1;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.exit_roundabout_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
-  boost::replace_all(instruction, kBeginStreetNamesTag, begin_street_names);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.exit_roundabout_verbal_subset, phrase_id, {
+      { kStreetNamesTag, street_names },
+      { kBeginStreetNamesTag, begin_street_names } });
 
   return instruction;
 
@@ -2318,7 +2185,6 @@ std::string NarrativeBuilder::FormEnterFerryInstruction(Maneuver& maneuver) {
   // "2": "Take the <STREET_NAMES> <FERRY_LABEL>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign the street names
   std::string street_names = FormStreetNames(
@@ -2336,12 +2202,10 @@ std::string NarrativeBuilder::FormEnterFerryInstruction(Maneuver& maneuver) {
     }
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.enter_ferry_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
-  boost::replace_all(instruction, kFerryLabelTag, ferry_label);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.enter_ferry_subset, phrase_id, {
+      { kStreetNamesTag, street_names },
+      { kFerryLabelTag, ferry_label } });
 
   return instruction;
 }
@@ -2362,7 +2226,6 @@ std::string NarrativeBuilder::FormVerbalEnterFerryInstruction(
   // "2": "Take the <STREET_NAMES> <FERRY_LABEL>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign the street names
   std::string street_names = FormStreetNames(
@@ -2381,12 +2244,10 @@ std::string NarrativeBuilder::FormVerbalEnterFerryInstruction(
     }
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.enter_ferry_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
-  boost::replace_all(instruction, kFerryLabelTag, ferry_label);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.enter_ferry_verbal_subset, phrase_id, {
+      { kStreetNamesTag, street_names },
+      { kFerryLabelTag, ferry_label } });
 
   return instruction;
 
@@ -2407,7 +2268,6 @@ std::string NarrativeBuilder::FormExitFerryInstruction(Maneuver& maneuver) {
   // "18": "Bike <CARDINAL_DIRECTION> on <BEGIN_STREET_NAMES>. Continue on <STREET_NAMES>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Set cardinal_direction value
   std::string cardinal_direction = dictionary_.exit_ferry_subset
@@ -2438,14 +2298,11 @@ std::string NarrativeBuilder::FormExitFerryInstruction(Maneuver& maneuver) {
     phrase_id += 16;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.exit_ferry_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kCardinalDirectionTag, cardinal_direction);
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
-  boost::replace_all(instruction, kBeginStreetNamesTag, begin_street_names);
-
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.exit_ferry_subset, phrase_id, {
+      { kCardinalDirectionTag, cardinal_direction },
+      { kStreetNamesTag, street_names },
+      { kBeginStreetNamesTag, begin_street_names } });
 
   return instruction;
 
@@ -2485,7 +2342,6 @@ std::string NarrativeBuilder::FormVerbalExitFerryInstruction(
   // "18": "Bike <CARDINAL_DIRECTION> on <BEGIN_STREET_NAMES>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Set cardinal_direction value
   std::string cardinal_direction = dictionary_.exit_ferry_verbal_subset
@@ -2518,14 +2374,11 @@ std::string NarrativeBuilder::FormVerbalExitFerryInstruction(
     phrase_id += 16;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.exit_ferry_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kCardinalDirectionTag, cardinal_direction);
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
-  boost::replace_all(instruction, kBeginStreetNamesTag, begin_street_names);
-
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.exit_ferry_verbal_subset, phrase_id, {
+      { kCardinalDirectionTag, cardinal_direction },
+      { kStreetNamesTag, street_names },
+      { kBeginStreetNamesTag, begin_street_names } });
 
   return instruction;
 
@@ -2538,7 +2391,6 @@ std::string NarrativeBuilder::FormTransitConnectionStartInstruction(
   // "2": "Enter the <TRANSIT_STOP> <STATION_LABEL>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign transit stop
   std::string transit_stop = maneuver.transit_connection_stop().name;
@@ -2555,12 +2407,10 @@ std::string NarrativeBuilder::FormTransitConnectionStartInstruction(
     }
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.transit_connection_start_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kTransitStopTag, transit_stop);
-  boost::replace_all(instruction, kStationLabelTag, station_label);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.transit_connection_start_subset, phrase_id, {
+      { kTransitStopTag, transit_stop },
+      { kStationLabelTag, station_label } });
 
   return instruction;
 
@@ -2573,7 +2423,6 @@ std::string NarrativeBuilder::FormVerbalTransitConnectionStartInstruction(
   // "2": "Enter the <TRANSIT_STOP> <STATION_LABEL>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign transit stop
   std::string transit_stop = maneuver.transit_connection_stop().name;
@@ -2590,12 +2439,10 @@ std::string NarrativeBuilder::FormVerbalTransitConnectionStartInstruction(
     }
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.transit_connection_start_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kTransitStopTag, transit_stop);
-  boost::replace_all(instruction, kStationLabelTag, station_label);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.transit_connection_start_verbal_subset, phrase_id, {
+      { kTransitStopTag, transit_stop },
+      { kStationLabelTag, station_label } });
 
   return instruction;
 
@@ -2608,7 +2455,6 @@ std::string NarrativeBuilder::FormTransitConnectionTransferInstruction(
   // "2": "Transfer at the <TRANSIT_STOP> <STATION_LABEL>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign transit stop
   std::string transit_stop = maneuver.transit_connection_stop().name;
@@ -2625,12 +2471,10 @@ std::string NarrativeBuilder::FormTransitConnectionTransferInstruction(
     }
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.transit_connection_transfer_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kTransitStopTag, transit_stop);
-  boost::replace_all(instruction, kStationLabelTag, station_label);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.transit_connection_transfer_subset, phrase_id, {
+      { kTransitStopTag, transit_stop },
+      { kStationLabelTag, station_label } });
 
   return instruction;
 
@@ -2643,7 +2487,6 @@ std::string NarrativeBuilder::FormVerbalTransitConnectionTransferInstruction(
   // "2": "Transfer at the <TRANSIT_STOP> <STATION_LABEL>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign transit stop
   std::string transit_stop = maneuver.transit_connection_stop().name;
@@ -2660,12 +2503,10 @@ std::string NarrativeBuilder::FormVerbalTransitConnectionTransferInstruction(
     }
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.transit_connection_transfer_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kTransitStopTag, transit_stop);
-  boost::replace_all(instruction, kStationLabelTag, station_label);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.transit_connection_transfer_verbal_subset, phrase_id, {
+      { kTransitStopTag, transit_stop },
+      { kStationLabelTag, station_label } });
 
   return instruction;
 
@@ -2678,7 +2519,6 @@ std::string NarrativeBuilder::FormTransitConnectionDestinationInstruction(
   // "2": "Exit the <TRANSIT_STOP> <STATION_LABEL>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign transit stop
   std::string transit_stop = maneuver.transit_connection_stop().name;
@@ -2695,12 +2535,10 @@ std::string NarrativeBuilder::FormTransitConnectionDestinationInstruction(
     }
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.transit_connection_destination_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kTransitStopTag, transit_stop);
-  boost::replace_all(instruction, kStationLabelTag, station_label);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.transit_connection_destination_subset, phrase_id, {
+      { kTransitStopTag, transit_stop },
+      { kStationLabelTag, station_label } });
 
   return instruction;
 
@@ -2713,7 +2551,6 @@ std::string NarrativeBuilder::FormVerbalTransitConnectionDestinationInstruction(
   // "2": "Exit the <TRANSIT_STOP> <STATION_LABEL>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign transit stop
   std::string transit_stop = maneuver.transit_connection_stop().name;
@@ -2730,12 +2567,10 @@ std::string NarrativeBuilder::FormVerbalTransitConnectionDestinationInstruction(
     }
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.transit_connection_destination_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kTransitStopTag, transit_stop);
-  boost::replace_all(instruction, kStationLabelTag, station_label);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.transit_connection_destination_verbal_subset, phrase_id, {
+      { kTransitStopTag, transit_stop },
+      { kStationLabelTag, station_label } });
 
   return instruction;
 
@@ -2746,7 +2581,6 @@ std::string NarrativeBuilder::FormDepartInstruction(Maneuver& maneuver) {
   // "1": "Depart: <TIME> from <TRANSIT_STOP>"
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
   uint8_t phrase_id = 0;
   std::string transit_stop_name = maneuver.GetTransitStops().front().name;
 
@@ -2754,13 +2588,11 @@ std::string NarrativeBuilder::FormDepartInstruction(Maneuver& maneuver) {
     phrase_id = 1;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.depart_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kTransitStopTag, transit_stop_name);
-  boost::replace_all(instruction, kTimeTag,
-      get_localized_time(maneuver.GetTransitDepartureTime(), dictionary_.GetLocale()));
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.depart_subset, phrase_id, {
+      { kTransitStopTag, transit_stop_name },
+      { kTimeTag,
+        get_localized_time(maneuver.GetTransitDepartureLocalTime(), dictionary_) } });
 
   return instruction;
 }
@@ -2770,7 +2602,6 @@ std::string NarrativeBuilder::FormVerbalDepartInstruction(Maneuver& maneuver) {
   // "1": "Depart at <TIME> from <TRANSIT_STOP>"
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
   uint8_t phrase_id = 0;
   std::string transit_stop_name = maneuver.GetTransitStops().front().name;
 
@@ -2778,13 +2609,11 @@ std::string NarrativeBuilder::FormVerbalDepartInstruction(Maneuver& maneuver) {
     phrase_id = 1;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.depart_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kTransitStopTag, transit_stop_name);
-  boost::replace_all(instruction, kTimeTag,
-      get_localized_time(maneuver.GetTransitDepartureTime(), dictionary_.GetLocale()));
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.depart_verbal_subset, phrase_id, {
+      { kTransitStopTag, transit_stop_name },
+      { kTimeTag,
+        get_localized_time(maneuver.GetTransitDepartureLocalTime(), dictionary_) } });
 
   return instruction;
 }
@@ -2794,7 +2623,6 @@ std::string NarrativeBuilder::FormArriveInstruction(Maneuver& maneuver) {
   // "1": "Arrive: <TIME> at <TRANSIT_STOP>"
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
   uint8_t phrase_id = 0;
   std::string transit_stop_name = maneuver.GetTransitStops().back().name;
 
@@ -2802,13 +2630,11 @@ std::string NarrativeBuilder::FormArriveInstruction(Maneuver& maneuver) {
     phrase_id = 1;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.arrive_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kTransitStopTag, transit_stop_name);
-  boost::replace_all(instruction, kTimeTag,
-      get_localized_time(maneuver.GetTransitArrivalTime(), dictionary_.GetLocale()));
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.arrive_subset, phrase_id, {
+      { kTransitStopTag, transit_stop_name },
+      { kTimeTag,
+        get_localized_time(maneuver.GetTransitArrivalLocalTime(), dictionary_) } });
 
   return instruction;
 }
@@ -2818,7 +2644,6 @@ std::string NarrativeBuilder::FormVerbalArriveInstruction(Maneuver& maneuver) {
   // "1": "Arrive at <TIME> at <TRANSIT_STOP>"
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
   uint8_t phrase_id = 0;
   std::string transit_stop_name = maneuver.GetTransitStops().back().name;
 
@@ -2826,13 +2651,11 @@ std::string NarrativeBuilder::FormVerbalArriveInstruction(Maneuver& maneuver) {
     phrase_id = 1;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.arrive_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kTransitStopTag, transit_stop_name);
-  boost::replace_all(instruction, kTimeTag,
-      get_localized_time(maneuver.GetTransitArrivalTime(), dictionary_.GetLocale()));
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.arrive_verbal_subset, phrase_id, {
+      { kTransitStopTag, transit_stop_name },
+      { kTimeTag,
+        get_localized_time(maneuver.GetTransitArrivalLocalTime(), dictionary_) } });
 
   return instruction;
 }
@@ -2843,7 +2666,6 @@ std::string NarrativeBuilder::FormTransitInstruction(
   // "1": "Take the <TRANSIT_NAME> toward <TRANSIT_HEADSIGN>. (<TRANSIT_STOP_COUNT> <TRANSIT_STOP_COUNT_LABEL>)"
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
   uint8_t phrase_id = 0;
   std::string transit_headsign = maneuver.transit_info().headsign;
   auto stop_count = maneuver.GetTransitStopCount();
@@ -2854,18 +2676,13 @@ std::string NarrativeBuilder::FormTransitInstruction(
     phrase_id = 1;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.transit_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(
-      instruction,
-      kTransitNameTag,
-      FormTransitName(maneuver,
-                      dictionary_.transit_subset.empty_transit_name_labels));
-  boost::replace_all(instruction, kTransitHeadSignTag, transit_headsign);
-  boost::replace_all(instruction, kTransitStopCountTag, std::to_string(stop_count)); //TODO: locale specific numerals
-  boost::replace_all(instruction, kTransitStopCountLabelTag, stop_count_label);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.transit_subset, phrase_id, {
+      { kTransitNameTag,
+        FormTransitName(maneuver, dictionary_.transit_subset.empty_transit_name_labels) },
+      { kTransitHeadSignTag, transit_headsign },
+      { kTransitStopCountTag, std::to_string(stop_count) }, //TODO: locale specific numerals
+      { kTransitStopCountLabelTag, stop_count_label } });
 
   return instruction;
 }
@@ -2875,7 +2692,6 @@ std::string NarrativeBuilder::FormVerbalTransitInstruction(Maneuver& maneuver) {
   // "1": "Take the <TRANSIT_NAME> toward <TRANSIT_HEADSIGN>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
   uint8_t phrase_id = 0;
   std::string transit_headsign = maneuver.transit_info().headsign;
 
@@ -2883,16 +2699,11 @@ std::string NarrativeBuilder::FormVerbalTransitInstruction(Maneuver& maneuver) {
     phrase_id = 1;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.transit_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(
-      instruction,
-      kTransitNameTag,
-      FormTransitName(maneuver,
-                      dictionary_.transit_verbal_subset.empty_transit_name_labels));
-  boost::replace_all(instruction, kTransitHeadSignTag, transit_headsign);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.transit_verbal_subset, phrase_id, {
+      { kTransitNameTag,
+        FormTransitName(maneuver, dictionary_.transit_verbal_subset.empty_transit_name_labels) },
+      { kTransitHeadSignTag, transit_headsign } });
 
   return instruction;
 }
@@ -2903,7 +2714,6 @@ std::string NarrativeBuilder::FormTransitRemainOnInstruction(
   // "1": "Remain on the <TRANSIT_NAME> toward <TRANSIT_HEADSIGN>. (<TRANSIT_STOP_COUNT> <TRANSIT_STOP_COUNT_LABEL>)"
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
   uint8_t phrase_id = 0;
   std::string transit_headsign = maneuver.transit_info().headsign;
   auto stop_count = maneuver.GetTransitStopCount();
@@ -2914,19 +2724,13 @@ std::string NarrativeBuilder::FormTransitRemainOnInstruction(
     phrase_id = 1;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.transit_remain_on_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(
-      instruction,
-      kTransitNameTag,
-      FormTransitName(
-          maneuver,
-          dictionary_.transit_remain_on_subset.empty_transit_name_labels));
-  boost::replace_all(instruction, kTransitHeadSignTag, transit_headsign);
-  boost::replace_all(instruction, kTransitStopCountTag, std::to_string(stop_count)); //TODO: locale specific numerals
-  boost::replace_all(instruction, kTransitStopCountLabelTag, stop_count_label);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.transit_remain_on_subset, phrase_id, {
+      { kTransitNameTag,
+        FormTransitName(maneuver, dictionary_.transit_remain_on_subset.empty_transit_name_labels) },
+      { kTransitHeadSignTag, transit_headsign },
+      { kTransitStopCountTag, std::to_string(stop_count) }, //TODO: locale specific numerals
+      { kTransitStopCountLabelTag, stop_count_label } });
 
   return instruction;
 
@@ -2938,7 +2742,6 @@ std::string NarrativeBuilder::FormVerbalTransitRemainOnInstruction(
   // "1": "Remain on the <TRANSIT_NAME> toward <TRANSIT_HEADSIGN>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
   uint8_t phrase_id = 0;
   std::string transit_headsign = maneuver.transit_info().headsign;
 
@@ -2946,17 +2749,11 @@ std::string NarrativeBuilder::FormVerbalTransitRemainOnInstruction(
     phrase_id = 1;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.transit_remain_on_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(
-      instruction,
-      kTransitNameTag,
-      FormTransitName(
-          maneuver,
-          dictionary_.transit_remain_on_verbal_subset.empty_transit_name_labels));
-  boost::replace_all(instruction, kTransitHeadSignTag, transit_headsign);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.transit_remain_on_verbal_subset, phrase_id, {
+      { kTransitNameTag,
+        FormTransitName(maneuver, dictionary_.transit_remain_on_verbal_subset.empty_transit_name_labels) },
+      { kTransitHeadSignTag, transit_headsign } });
 
   return instruction;
 }
@@ -2967,7 +2764,6 @@ std::string NarrativeBuilder::FormTransitTransferInstruction(
   // "1": "Transfer to take the <TRANSIT_NAME> toward <TRANSIT_HEADSIGN>. (<TRANSIT_STOP_COUNT> <TRANSIT_STOP_COUNT_LABEL>)"
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
   uint8_t phrase_id = 0;
   std::string transit_headsign = maneuver.transit_info().headsign;
   auto stop_count = maneuver.GetTransitStopCount();
@@ -2978,19 +2774,13 @@ std::string NarrativeBuilder::FormTransitTransferInstruction(
     phrase_id = 1;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.transit_transfer_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(
-      instruction,
-      kTransitNameTag,
-      FormTransitName(
-          maneuver,
-          dictionary_.transit_transfer_subset.empty_transit_name_labels));
-  boost::replace_all(instruction, kTransitHeadSignTag, transit_headsign);
-  boost::replace_all(instruction, kTransitStopCountTag, std::to_string(stop_count)); //TODO: locale specific numerals
-  boost::replace_all(instruction, kTransitStopCountLabelTag, stop_count_label);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.transit_transfer_subset, phrase_id, {
+      { kTransitNameTag,
+        FormTransitName(maneuver, dictionary_.transit_transfer_subset.empty_transit_name_labels) },
+      { kTransitHeadSignTag, transit_headsign },
+      { kTransitStopCountTag, std::to_string(stop_count) }, //TODO: locale specific numerals
+      { kTransitStopCountLabelTag, stop_count_label } });
 
   return instruction;
 
@@ -3002,7 +2792,6 @@ std::string NarrativeBuilder::FormVerbalTransitTransferInstruction(
   // "1": "Transfer to take the <TRANSIT_NAME> toward <TRANSIT_HEADSIGN>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
   uint8_t phrase_id = 0;
   std::string transit_headsign = maneuver.transit_info().headsign;
 
@@ -3010,17 +2799,11 @@ std::string NarrativeBuilder::FormVerbalTransitTransferInstruction(
     phrase_id = 1;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.transit_transfer_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(
-      instruction,
-      kTransitNameTag,
-      FormTransitName(
-          maneuver,
-          dictionary_.transit_transfer_verbal_subset.empty_transit_name_labels));
-  boost::replace_all(instruction, kTransitHeadSignTag, transit_headsign);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.transit_transfer_verbal_subset, phrase_id, {
+      { kTransitNameTag,
+        FormTransitName(maneuver, dictionary_.transit_transfer_verbal_subset.empty_transit_name_labels) },
+      { kTransitHeadSignTag, transit_headsign } });
 
   return instruction;
 
@@ -3042,7 +2825,6 @@ std::string NarrativeBuilder::FormPostTransitConnectionDestinationInstruction(
   // "18": "Bike <CARDINAL_DIRECTION> on <BEGIN_STREET_NAMES>. Continue on <STREET_NAMES>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Set cardinal_direction value
   std::string cardinal_direction = dictionary_.post_transit_connection_destination_subset
@@ -3073,15 +2855,11 @@ std::string NarrativeBuilder::FormPostTransitConnectionDestinationInstruction(
     phrase_id += 16;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.post_transit_connection_destination_subset.
-      phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kCardinalDirectionTag, cardinal_direction);
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
-  boost::replace_all(instruction, kBeginStreetNamesTag, begin_street_names);
-
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.post_transit_connection_destination_subset, phrase_id, {
+      { kCardinalDirectionTag, cardinal_direction },
+      { kStreetNamesTag, street_names },
+      { kBeginStreetNamesTag, begin_street_names } });
 
   return instruction;
 
@@ -3103,7 +2881,6 @@ std::string NarrativeBuilder::FormVerbalPostTransitConnectionDestinationInstruct
   // "18": "Bike <CARDINAL_DIRECTION> on <BEGIN_STREET_NAMES>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Set cardinal_direction value
   std::string cardinal_direction = dictionary_.post_transit_connection_destination_verbal_subset
@@ -3136,13 +2913,11 @@ std::string NarrativeBuilder::FormVerbalPostTransitConnectionDestinationInstruct
     phrase_id += 16;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.post_transit_connection_destination_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kCardinalDirectionTag, cardinal_direction);
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
-  boost::replace_all(instruction, kBeginStreetNamesTag, begin_street_names);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.post_transit_connection_destination_verbal_subset, phrase_id, {
+      { kCardinalDirectionTag, cardinal_direction },
+      { kStreetNamesTag, street_names },
+      { kBeginStreetNamesTag, begin_street_names } });
 
   return instruction;
 }
@@ -3154,7 +2929,6 @@ std::string NarrativeBuilder::FormVerbalPostTransitionInstruction(
   // "1": "Continue on <STREET_NAMES> for <LENGTH>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Assign the street names
   std::string street_names = FormStreetNames(
@@ -3168,16 +2942,11 @@ std::string NarrativeBuilder::FormVerbalPostTransitionInstruction(
     phrase_id = 1;
   }
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.post_transition_verbal_subset.phrases.at(
-      std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kLengthTag,
-      FormLength(
-          maneuver, dictionary_.post_transition_verbal_subset.metric_lengths,
-          dictionary_.post_transition_verbal_subset.us_customary_lengths));
-  boost::replace_all(instruction, kStreetNamesTag, street_names);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.post_transition_verbal_subset, phrase_id, {
+      { kLengthTag,
+        FormLength(maneuver, dictionary_.post_transition_verbal_subset.length_phrases) },
+      { kStreetNamesTag, street_names } });
 
   return instruction;
 }
@@ -3187,7 +2956,6 @@ std::string NarrativeBuilder::FormVerbalPostTransitionTransitInstruction(
   // "0": "Travel <TRANSIT_STOP_COUNT> <TRANSIT_STOP_COUNT_LABEL>."
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
   uint8_t phrase_id = 0;
   auto stop_count = maneuver.GetTransitStopCount();
   auto stop_count_label = FormTransitStopCountLabel(
@@ -3195,12 +2963,10 @@ std::string NarrativeBuilder::FormVerbalPostTransitionTransitInstruction(
       dictionary_.post_transition_transit_verbal_subset
           .transit_stop_count_labels);
 
-  // Set instruction to the determined tagged phrase
-  instruction = dictionary_.post_transition_transit_verbal_subset.phrases.at(std::to_string(phrase_id));
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kTransitStopCountTag, std::to_string(stop_count)); //TODO: locale specific numerals
-  boost::replace_all(instruction, kTransitStopCountLabelTag, stop_count_label);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.post_transition_transit_verbal_subset, phrase_id, {
+      { kTransitStopCountTag, std::to_string(stop_count) }, //TODO: locale specific numerals
+      { kTransitStopCountLabelTag, stop_count_label } });
 
   return instruction;
 }
@@ -3224,133 +2990,47 @@ std::string NarrativeBuilder::GetPluralCategory(size_t count) {
   return kPluralCategoryOtherKey;
 }
 
-std::string NarrativeBuilder::FormLength(
-    Maneuver& maneuver, const std::vector<std::string>& metric_lengths,
-    const std::vector<std::string>& us_customary_lengths) {
-  switch (directions_options_.units()) {
-    case DirectionsOptions_Units_kMiles: {
-      return FormUsCustomaryLength(
-          maneuver.length(DirectionsOptions_Units_kMiles), us_customary_lengths);
-    }
-    default: {
-      return FormMetricLength(
-          maneuver.length(DirectionsOptions_Units_kKilometers), metric_lengths);
-    }
-  }
-}
+std::string NarrativeBuilder::FormPhrase(
+    const PhraseSet& subset, uint8_t phrase_id,
+    std::initializer_list<PhraseTag> phrase_tags) {
+  const std::string& phrase = subset.phrases.at(std::to_string(phrase_id));
 
-std::string NarrativeBuilder::FormMetricLength(
-    float kilometers, const std::vector<std::string>& metric_lengths) {
-
-  // 0 "<KILOMETERS> kilometers"
-  // 1 "1 kilometer"
-  // 2 "a half kilometer"
-  // 3 "<METERS> meters" (30-400 and 600-900 meters)
-  // 4 "less than 10 meters"
-
-  std::string length_string;
-  length_string.reserve(kLengthStringInitialCapacity);
-
-  // Follow locale rules turning numbers into strings
-  std::stringstream distance;
-  distance.imbue(dictionary_.GetLocale());
-  // These will determine what we say
-  int tenths = std::round(kilometers * 10);
-
-  if (tenths > 10) {
-    // 0 "<KILOMETERS> kilometers"
-    length_string += metric_lengths.at(kKilometersIndex);
-    distance << std::setiosflags(std::ios::fixed) << std::setprecision(tenths % 10 > 0) << kilometers;
-  } else if (tenths == 10) {
-    // 1 "1 kilometer"
-    length_string += metric_lengths.at(kOneKilometerIndex);
-  } else if (tenths == 5) {
-    // 2 "a half kilometer"
-    length_string += metric_lengths.at(kHalfKilometerIndex);
-  } else {
-    int meters = std::round(kilometers * 1000);
-    if (meters > 94) {
-      // 3 "<METERS> meters" (100-400 and 600-900 meters)
-      length_string += metric_lengths.at(kMetersIndex);
-      distance << ((meters + 50) / 100) * 100;
-    } else if (meters > 9) {
-      // 3 "<METERS> meters" (10-90 meters)
-      length_string += metric_lengths.at(kMetersIndex);
-      distance << ((meters + 5) / 10) * 10;
-    } else {
-      // 4 "less than 10 meters"
-      length_string += metric_lengths.at(kSmallMetersIndex);
+  // The rendered phrase only depends on the tagged phrase, which the locale
+  // keeps for the life of the process, and the tag values
+  InstructionCache& cache = get_instruction_cache();
+  InstructionCache::Key key{ &phrase, 0 };
+  std::string instruction;
+  if (cache.enabled()) {
+    key = InstructionCache::GetKey(phrase, phrase_tags);
+    if (cache.Find(key, phrase_tags, instruction)) {
+      return instruction;
     }
   }
 
-  //TODO: why do we need separate tags for kilometers and meters?
-  // Replace tags with length values
-  boost::replace_all(length_string, kKilometersTag, distance.str());
-  boost::replace_all(length_string, kMetersTag, distance.str());
-
-  return length_string;
-}
-
-std::string NarrativeBuilder::FormUsCustomaryLength(
-    float miles, const std::vector<std::string>& us_customary_lengths) {
-
-  // 0  "<MILES> miles"
-  // 1  "1 mile"
-  // 2  "a half mile"
-  // 3  "<TENTHS_OF_MILE> tenths of a mile" (2-4, 6-9)
-  // 4  "1 tenth of a mile"
-  // 5  "<FEET> feet" (10-90, 100-500)
-  // 6  "less than 10 feet"
-
-  std::string length_string;
-  length_string.reserve(kLengthStringInitialCapacity);
-  
-  // Follow locale rules turning numbers into strings
-  std::stringstream distance;
-  distance.imbue(dictionary_.GetLocale());
-  // These will determine what we say
-  int tenths = std::round(miles * 10);
-
-  if (tenths > 10) {
-    // 0  "<MILES> miles"
-    length_string += us_customary_lengths.at(kMilesIndex);
-    distance << std::setiosflags(std::ios::fixed) << std::setprecision(tenths % 10 > 0) << miles;
-  } else if (tenths == 10) {
-    // 1  "1 mile"
-    length_string += us_customary_lengths.at(kOneMileIndex);
-  } else if (tenths == 5) {
-    // 2  "a half mile"
-    length_string += us_customary_lengths.at(kHalfMileIndex);
-  } else if (tenths > 1) {
-    // 3  "<TENTHS_OF_MILE> tenths of a mile" (2-4, 6-9)
-    length_string += us_customary_lengths.at(kTenthsOfMileIndex);
-    distance << tenths;
-  } else if (miles > 0.0973f && tenths == 1) {
-    // 4  "1 tenth of a mile"
-    length_string += us_customary_lengths.at(kOneTenthOfMileIndex);
-  } else {
-    int feet = std::round(miles * 5280);
-    if (feet > 94) {
-      // 5  "<FEET> feet" (100-500)
-      length_string += us_customary_lengths.at(kFeetIndex);
-      distance << ((feet + 50) / 100) * 100;
-    } else if (feet > 9) {
-      // 5  "<FEET> feet" (10-90)
-      length_string += us_customary_lengths.at(kFeetIndex);
-      distance << ((feet + 5) / 10) * 10;
-    } else {
-      // 6  "less than 10 feet"
-      length_string += us_customary_lengths.at(kSmallFeetIndex);
-    }
+  // Replace phrase tags with values
+  instruction = phrase;
+  for (const auto& phrase_tag : phrase_tags) {
+    boost::replace_all(instruction, phrase_tag.tag, phrase_tag.value);
   }
 
-  //TODO: why do we need separate tags for miles, tenths and feet?
-  // Replace tags with length values
-  boost::replace_all(length_string, kMilesTag, distance.str());
-  boost::replace_all(length_string, kTenthsOfMilesTag, distance.str());
-  boost::replace_all(length_string, kFeetTag, distance.str());
+  if (cache.enabled()) {
+    cache.Insert(key, phrase_tags, instruction);
+  }
+  return instruction;
+}
 
-  return length_string;
+std::string NarrativeBuilder::FormLength(
+    Maneuver& maneuver, const LengthPhraseTable& length_phrases) {
+  switch (directions_options_.units()) {
+    case DirectionsOptions_Units_kMiles: {
+      return length_phrases.GetUsCustomaryLength(
+          maneuver.length(DirectionsOptions_Units_kMiles));
+    }
+    default: {
+      return length_phrases.GetMetricLength(
+          maneuver.length(DirectionsOptions_Units_kKilometers));
+    }
+  }
 }
 
 std::string NarrativeBuilder::FormRelativeTwoDirection(
@@ -3508,7 +3188,6 @@ std::string NarrativeBuilder::FormVerbalMultiCue(Maneuver* maneuver,
   // "0": "<CURRENT_VERBAL_CUE> Then <NEXT_VERBAL_CUE>"
 
   std::string instruction;
-  instruction.reserve(kInstructionInitialCapacity);
 
   // Set current verbal cue
   std::string current_verbal_cue = maneuver->verbal_pre_transition_instruction();
@@ -3521,11 +3200,10 @@ std::string NarrativeBuilder::FormVerbalMultiCue(Maneuver* maneuver,
 
 
   // Set instruction to the verbal multi-cue
-  instruction = dictionary_.verbal_multi_cue_subset.phrases.at("0");
-
-  // Replace phrase tags with values
-  boost::replace_all(instruction, kCurrentVerbalCueTag, current_verbal_cue);
-  boost::replace_all(instruction, kNextVerbalCueTag, next_verbal_cue);
+  // Set instruction to the determined tagged phrase with its tags replaced
+  instruction = FormPhrase(dictionary_.verbal_multi_cue_subset, 0, {
+      { kCurrentVerbalCueTag, current_verbal_cue },
+      { kNextVerbalCueTag, next_verbal_cue } });
 
   return instruction;
 }
@@ -0,0 +1,162 @@
+#include <cstdio>
+#include <cstring>
+#include <climits>
+
+#include "odin/number_formatter.h"
+
+namespace {
+
+// Large enough for any double written with a fixed number of decimals
+constexpr size_t kMaxDigits = 352;
+
+// Large enough for the short values used in narrative
+constexpr size_t kFormatBufferSize = 64;
+
+}
+
+namespace valhalla {
+namespace odin {
+
+NumberFormatter::NumberFormatter()
+    : NumberFormatter(std::locale::classic()) {
+}
+
+NumberFormatter::NumberFormatter(const std::locale& locale) {
+  const auto& numpunct = std::use_facet<std::numpunct<char> >(locale);
+  decimal_point_ = numpunct.decimal_point();
+  thousands_sep_ = numpunct.thousands_sep();
+  grouping_ = numpunct.grouping();
+
+  // Same rules the standard library uses: the grouping ends at the first
+  // nul and is not used at all if the first group size is not valid
+  grouping_.resize(std::strlen(grouping_.c_str()));
+  if (grouping_.empty() || (static_cast<signed char>(grouping_[0]) <= 0)
+      || (grouping_[0] == CHAR_MAX)) {
+    grouping_.clear();
+  }
+}
+
+size_t NumberFormatter::Format(double value, uint32_t precision, char* buffer,
+                               size_t size) const {
+  char raw[kMaxDigits];
+  int raw_length = std::snprintf(raw, sizeof(raw), "%.*f",
+                                 static_cast<int>(precision), value);
+  if ((raw_length <= 0) || (static_cast<size_t>(raw_length) >= sizeof(raw))) {
+    return 0;
+  }
+
+  // Split into sign, integer digits and fraction digits. The decimal point
+  // written by snprintf depends on the C locale so it is never copied.
+  const char* digits = raw;
+  bool negative = (*digits == '-');
+  if (negative) {
+    ++digits;
+  }
+  size_t digit_count = 0;
+  while ((digits[digit_count] >= '0') && (digits[digit_count] <= '9')) {
+    ++digit_count;
+  }
+
+  // Not a finite number so there is nothing to localize
+  if (digit_count == 0) {
+    if (static_cast<size_t>(raw_length) > size) {
+      return 0;
+    }
+    std::memcpy(buffer, raw, raw_length);
+    return raw_length;
+  }
+
+  size_t length = FormatIntegerPart(digits, digit_count, negative, buffer,
+                                    size);
+  if ((length == 0) || (precision == 0)) {
+    return length;
+  }
+
+  if ((length + 1 + precision) > size) {
+    return 0;
+  }
+  buffer[length++] = decimal_point_;
+  std::memcpy(buffer + length, raw + raw_length - precision, precision);
+  return length + precision;
+}
+
+size_t NumberFormatter::Format(int value, char* buffer, size_t size) const {
+  char raw[16];
+  int raw_length = std::snprintf(raw, sizeof(raw), "%d", value);
+  if (raw_length <= 0) {
+    return 0;
+  }
+  bool negative = (raw[0] == '-');
+  return FormatIntegerPart(raw + negative, raw_length - negative, negative,
+                           buffer, size);
+}
+
+std::string NumberFormatter::Format(double value, uint32_t precision) const {
+  char buffer[kFormatBufferSize];
+  size_t length = Format(value, precision, buffer, sizeof(buffer));
+  if (length == 0) {
+    // Only happens for huge values so fall back to a heap buffer
+    std::string str(kMaxDigits * 2, '\0');
+    str.resize(Format(value, precision, &str[0], str.size()));
+    return str;
+  }
+  return std::string(buffer, length);
+}
+
+std::string NumberFormatter::Format(int value) const {
+  char buffer[kFormatBufferSize];
+  return std::string(buffer, Format(value, buffer, sizeof(buffer)));
+}
+
+size_t NumberFormatter::FormatIntegerPart(const char* digits,
+                                          size_t digit_count, bool negative,
+                                          char* buffer, size_t size) const {
+  // Find the size of each group, starting from the right most digit
+  // The last group size repeats until the digits run out or a group
+  // size of 0 or CHAR_MAX ends the grouping
+  size_t group_sizes[kMaxDigits];
+  size_t group_count = 0;
+  size_t remaining = digit_count;
+  size_t index = 0;
+  while (!grouping_.empty()) {
+    char group = grouping_[index];
+    if ((static_cast<signed char>(group) <= 0) || (group == CHAR_MAX)
+        || (remaining <= static_cast<size_t>(group))) {
+      break;
+    }
+    group_sizes[group_count++] = group;
+    remaining -= group;
+    if (index < (grouping_.size() - 1)) {
+      ++index;
+    }
+  }
+
+  size_t length = negative + digit_count + group_count;
+  if (length > size) {
+    return 0;
+  }
+
+  char* out = buffer;
+  if (negative) {
+    *out++ = '-';
+  }
+
+  // Leading digits that are not part of a full group
+  std::memcpy(out, digits, remaining);
+  out += remaining;
+  digits += remaining;
+
+  // Then each group preceded by the separator, from left to right
+  while (group_count > 0) {
+    size_t group = group_sizes[--group_count];
+    *out++ = thousands_sep_;
+    std::memcpy(out, digits, group);
+    out += group;
+    digits += group;
+  }
+
+  return length;
+}
+
+}
+}
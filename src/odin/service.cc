@@ -1,10 +1,14 @@
 #include <functional>
+#include <algorithm>
 #include <string>
 #include <stdexcept>
 #include <vector>
+#include <iterator>
 #include <unordered_map>
 #include <cstdint>
 #include <sstream>
+#include <thread>
+#include <chrono>
 
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/json_parser.hpp>
@@ -19,6 +23,9 @@
 #include "odin/service.h"
 #include "odin/util.h"
 #include "odin/directionsbuilder.h"
+#include "odin/job_capture.h"
+#include "odin/logger.h"
+#include "odin/shared_trip_paths.h"
 
 using namespace prime_server;
 using namespace valhalla;
@@ -54,20 +61,77 @@ namespace {
 
     return result;
   }
+
+  uint64_t nanoseconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+  }
 }
 
 namespace valhalla {
   namespace odin {
 
     odin_worker_t::odin_worker_t(const boost::property_tree::ptree& config):
-      config(config){}
+      config(config),
+      directions_cache(config.get<size_t>("odin.service.directions_cache_bytes", 0)),
+      stats_interval(config.get<uint32_t>("odin.service.stats_interval", 0)),
+      trace_requests(config.get<bool>("odin.service.trace_requests", false)),
+      trace_events(config.get<size_t>("odin.service.trace_file_bytes", 1 << 20) / sizeof(TraceEvent)),
+      trace_sample_rate(config.get<uint32_t>("odin.service.trace_sample_rate", 0)),
+      trace_sample_count(0),
+      batch(config.get<uint32_t>("odin.service.leg_threads", 1)){
+      //capture the jobs for odin_replay
+      auto capture_directory = config.get<std::string>("odin.service.capture_directory", "");
+      if(!capture_directory.empty())
+        capture.reset(new JobCapture(capture_directory, config.get<size_t>("odin.service.capture_file_bytes", 64 << 20),
+          config.get<size_t>("odin.service.capture_files", 4)));
+      //write the traces for odin_trace_decode, a client may only ask for one when the config allows it
+      auto trace_directory = config.get<std::string>("odin.service.trace_directory", "");
+      if(!trace_directory.empty())
+        trace_files.reset(new TraceFiles(trace_directory, config.get<size_t>("odin.service.trace_files", 64)));
+    }
 
     odin_worker_t::~odin_worker_t(){}
 
     worker_t::result_t odin_worker_t::work(const std::list<zmq::message_t>& job, void* request_info) {
       auto& info = *static_cast<http_request_t::info_t*>(request_info);
-      LOG_INFO("Got Odin Request " + std::to_string(info.id));
+      ODIN_LOG(kInfo, kRequest).Field("id", info.id);
+      //open the paths the upstream handed over in shared memory before anything can fail,
+      //they are all released whichever way the job ends so the upstream can reuse them
+      TripPathFrames legs;
+      for(auto leg = ++job.cbegin(); leg != job.cend(); ++leg)
+        legs.Add(static_cast<const char*>(leg->data()), leg->size());
+      //time the request and its stages when the stats are exported
+      auto request_start = std::chrono::steady_clock::now();
+      uint64_t parse_nanoseconds = 0;
+      auto error = [&](const valhalla_exception_t& exception) {
+        if(stats_interval) {
+          stats.RecordError(exception.error_code);
+          stats.Record(WorkerStats::kRequest, nanoseconds_since(request_start));
+        }
+        return jsonify_error(exception, info, jsonp);
+      };
       try{
+        //capture the job for odin_replay with the paths in shared memory written out,
+        //a capture that cannot be written is turned off rather than failing the jobs
+        if(capture) {
+          try {
+            capture->BeginJob(job.size());
+            capture->WriteFrame(job.front().data(), job.front().size());
+            auto leg = ++job.cbegin();
+            for(size_t i = 0; i < legs.size(); ++i, ++leg) {
+              if(legs.data(i))
+                capture->WriteFrame(legs.data(i), legs.size(i));
+              else
+                capture->WriteFrame(leg->data(), leg->size());
+            }
+            capture->EndJob();
+          }
+          catch(const std::exception& e) {
+            ODIN_LOG(kError, kRequest).Field("id", info.id).Field("capture_error", e.what());
+            capture.reset();
+          }
+        }
+
         //crack open the original request
         std::string request_str(static_cast<const char*>(job.front().data()), job.front().size());
         std::stringstream stream(request_str);
@@ -77,14 +141,28 @@ namespace valhalla {
           jsonp = request.get_optional<std::string>("jsonp");
         }
         catch(...) {
-          return jsonify_error({500, 200}, info, jsonp);
+          return error({500, 200});
         }
 
         // Grab language from options and set
         auto language = request.get_optional<std::string>("directions_options.language");
         // If language is not found then set to the default language (en-US)
+        bool default_language = false;
         if (!language || (odin::get_locales().find(*language) == odin::get_locales().end())) {
           request.put<std::string>("directions_options.language", odin::DirectionsOptions::default_instance().language());
+          default_language = true;
+        }
+        // Same goes for the additional languages so every leg gets one message per language
+        auto languages = request.get_child_optional("directions_options.languages");
+        if (languages) {
+          for (auto& additional : *languages) {
+            if (odin::get_locales().find(additional.second.get_value<std::string>()) == odin::get_locales().end()) {
+              additional.second.put_value(odin::DirectionsOptions::default_instance().language());
+              default_language = true;
+            }
+          }
+        }
+        if (default_language) {
           std::stringstream ss;
           boost::property_tree::write_json(ss, request, false);
           // Update request string with language
@@ -96,42 +174,156 @@ namespace valhalla {
         auto options = request.get_child_optional("directions_options");
         if(options)
           directions_options = valhalla::odin::GetDirectionsOptions(*options);
+        parse_nanoseconds += nanoseconds_since(request_start);
+        if(stats_interval)
+          stats.RecordRequest(directions_options.language());
 
         //forward the original request
         worker_t::result_t result{true};
         result.messages.emplace_back(std::move(request_str));
 
-        //for each leg
-        for(auto leg = ++job.cbegin(); leg != job.cend(); ++leg) {
-          //crack open the path
-          odin::TripPath trip_path;
-          try {
-            trip_path.ParseFromArray(leg->data(), static_cast<int>(leg->size()));
+        //trace the maneuver decisions of flagged or sampled requests
+        bool trace = trace_files && ((trace_requests && request.get<bool>("trace", false)) ||
+          (trace_sample_rate && (++trace_sample_count % trace_sample_rate) == 0));
+
+        //identical paths with identical options give identical directions
+        bool use_cache = directions_cache.enabled() && !trace && directions_options.languages_size() == 0;
+        std::string serialized_options;
+        if(use_cache)
+          serialized_options = directions_options.SerializeAsString();
+
+        //batch up the legs we dont already have directions for
+        batch.clear();
+        auto options_index = batch.AddOptions(directions_options);
+        size_t leg_count = legs.size();
+        std::vector<std::string> cache_keys(leg_count);
+        std::vector<std::string> cached(leg_count);
+        std::vector<size_t> batch_indices(leg_count, leg_count);
+        std::vector<size_t> first_legs(leg_count);
+        if(!legs.opened())
+          return error({500, 201});
+        duplicate_legs.clear();
+        size_t leg_index;
+        for(leg_index = 0; leg_index < leg_count; ++leg_index) {
+          //a path in shared memory is parsed in place
+          auto trip_path = legs.data(leg_index);
+          auto trip_path_size = legs.size(leg_index);
+
+          //legs repeated within the request are only built once
+          first_legs[leg_index] = leg_index;
+          if(leg_count > 1 && !trace) {
+            first_legs[leg_index] = duplicate_legs.Add(trip_path, trip_path_size);
+            if(first_legs[leg_index] != leg_index)
+              continue;
+          }
+
+          if(use_cache) {
+            cache_keys[leg_index] = DirectionsCache::MakeKey(trip_path, trip_path_size, serialized_options);
+            const auto* directions = directions_cache.Find(cache_keys[leg_index], trip_path, trip_path_size);
+            if(directions) {
+              cached[leg_index] = *directions;
+              continue;
+            }
           }
-          catch(...) {
-            return jsonify_error({500, 201}, info, jsonp);
+
+          //each traced leg gets its own buffer so the legs can be built in parallel
+          TraceBuffer* trace_buffer = nullptr;
+          if(trace) {
+            while(trace_buffers.size() <= leg_index)
+              trace_buffers.emplace_back(new TraceBuffer(trace_events));
+            trace_buffer = trace_buffers[leg_index].get();
+            trace_buffer->clear();
           }
+          batch_indices[leg_index] = batch.Add(options_index, trip_path, trip_path_size, trace_buffer);
+        }
 
-          //get some annotated directions
-          odin::DirectionsBuilder directions;
-          odin::TripDirections trip_directions;
-          try{
-            trip_directions = directions.Build(directions_options, trip_path);
+        //get some annotated directions, cache them while their paths can still be compared
+        //and then let the upstream reuse the shared memory
+        batch.Build(stats_interval != 0);
+        for(leg_index = 0; leg_index < leg_count; ++leg_index) {
+          if(cache_keys[leg_index].empty() || batch_indices[leg_index] == leg_count)
+            continue;
+          const auto& built = batch.GetResult(batch_indices[leg_index]);
+          if(!built.error_code)
+            directions_cache.Insert(cache_keys[leg_index], legs.data(leg_index), legs.size(leg_index), built.directions);
+        }
+        legs.Release();
+
+        //for each leg in order, a message per language
+        size_t language_count = directions_options.languages_size() + 1;
+        std::vector<std::list<std::string>::const_iterator> leg_directions(leg_count);
+        for(leg_index = 0; leg_index < leg_count; ++leg_index) {
+          //a repeated leg gets the directions of its first occurrence with its own leg id
+          if(first_legs[leg_index] != leg_index) {
+            auto directions = leg_directions[first_legs[leg_index]];
+            for(size_t language = 0; language < language_count; ++language, ++directions) {
+              result.messages.emplace_back(*directions);
+              duplicate_legs.SetLegId(leg_index, result.messages.back());
+            }
+            continue;
           }
-          catch(...) {
-            return jsonify_error({500, 202}, info, jsonp);
+
+          if(batch_indices[leg_index] == leg_count) {
+            result.messages.emplace_back(std::move(cached[leg_index]));
+            leg_directions[leg_index] = std::prev(result.messages.cend());
+            continue;
           }
 
-          LOG_INFO("maneuver_count::" + std::to_string(trip_directions.maneuver_size()));
+          auto& built = batch.GetResult(batch_indices[leg_index]);
+          if(built.error_code)
+            return error({500, built.error_code});
+          parse_nanoseconds += built.parse_nanoseconds;
+
+          ODIN_LOG(kInfo, kManeuvers).Field("id", info.id).Field("maneuver_count", built.maneuver_count);
+
+          //write the trace of the leg for odin_trace_decode, a trace that cannot be written is only logged
+          if(trace) {
+            try {
+              auto trace_file = trace_files->Write(info.id, leg_index, *trace_buffers[leg_index]);
+              ODIN_LOG(kInfo, kTraces).Field("id", info.id).Field("file", trace_file);
+            }
+            catch(const std::exception& e) {
+              ODIN_LOG(kError, kTraces).Field("id", info.id).Field("trace_error", e.what());
+            }
+          }
 
           //the protobuf directions
-          result.messages.emplace_back(trip_directions.SerializeAsString());
+          if(stats_interval) {
+            stats.Record(WorkerStats::kSerialize, built.serialize_nanoseconds);
+            stats.Record(built.stage_times);
+            stats.RecordLeg(built.node_count, built.maneuver_count);
+          }
+          result.messages.emplace_back(std::move(built.directions));
+          leg_directions[leg_index] = std::prev(result.messages.cend());
+          for(auto& translation : built.translations)
+            result.messages.emplace_back(std::move(translation));
+        }
+
+        if(directions_cache.enabled())
+          ODIN_LOG(kInfo, kCache).Field("name", "directions").Field("hits", directions_cache.hits())
+            .Field("misses", directions_cache.misses()).Field("evictions", directions_cache.evictions())
+            .Field("entries", directions_cache.size()).Field("bytes", directions_cache.bytes());
+
+        auto& instruction_cache = get_instruction_cache();
+        if(instruction_cache.enabled()) {
+          auto lookups = instruction_cache.hits() + instruction_cache.misses();
+          ODIN_LOG(kInfo, kCache).Field("name", "instruction").Field("hits", instruction_cache.hits())
+            .Field("misses", instruction_cache.misses()).Field("evictions", instruction_cache.evictions())
+            .Field("hit_rate", lookups ? instruction_cache.hits() * 100.0 / lookups : 0.0);
+        }
+
+        //one of the workers exports the stats of all of them now and then
+        if(stats_interval) {
+          stats.Record(WorkerStats::kParse, parse_nanoseconds);
+          stats.Record(WorkerStats::kRequest, nanoseconds_since(request_start));
+          if(WorkerStats::IsExportDue(stats_interval))
+            ODIN_LOG(kInfo, kStats).Field("json", WorkerStats::ToJson());
         }
 
         return result;
       }
       catch(const std::exception& e) {
-        return jsonify_error({400, 299, std::string(e.what())}, info, jsonp);
+        return error({400, 299, std::string(e.what())});
       }
     }
 
@@ -146,12 +338,36 @@ namespace valhalla {
       auto downstream_endpoint = config.get<std::string>("tyr.service.proxy") + "_in";
       //or returns just location information back to the server
       auto loopback_endpoint = config.get<std::string>("httpd.service.loopback");
+      //how many worker loops to run in this process
+      auto thread_count = std::max(config.get<unsigned int>("odin.service.threads", 1), 1u);
 
-      //listen for requests
+      //logging levels, sampling and the background writer are process wide
+      Logger::Configure(config);
+
+      //load the locales up front so the workers all share one immutable copy
+      get_locales();
+      //size the rendered instruction cache the workers share before they start
+      get_instruction_cache().set_max_entries(config.get<size_t>("odin.service.instruction_cache_entries", 0));
+
+      //zmq contexts are thread safe so all of the worker loops share this one
       zmq::context_t context;
-      prime_server::worker_t worker(context, upstream_endpoint, downstream_endpoint, loopback_endpoint,
-        std::bind(&odin_worker_t::work, odin_worker_t(config), std::placeholders::_1, std::placeholders::_2));
-      worker.work();
+
+      //each worker loop gets its own sockets and its own request state
+      auto work_loop = [&]() {
+        odin_worker_t odin_worker(config);
+        prime_server::worker_t worker(context, upstream_endpoint, downstream_endpoint, loopback_endpoint,
+          std::bind(&odin_worker_t::work, std::ref(odin_worker), std::placeholders::_1, std::placeholders::_2),
+          std::bind(&odin_worker_t::cleanup, std::ref(odin_worker)));
+        worker.work();
+      };
+
+      //listen for requests, this thread being one of the workers
+      std::list<std::thread> workers;
+      for(unsigned int i = 1; i < thread_count; ++i)
+        workers.emplace_back(work_loop);
+      work_loop();
+      for(auto& worker : workers)
+        worker.join();
 
       //TODO: should we listen for SIGINT and terminate gracefully/exit(0)?
     }
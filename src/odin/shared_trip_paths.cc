@@ -0,0 +1,431 @@
+#include <cstring>
+#include <chrono>
+#include <atomic>
+#include <mutex>
+#include <list>
+#include <algorithm>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "odin/shared_trip_paths.h"
+
+namespace {
+
+// The ring starts with its magic, capacity and id, the records follow
+constexpr char kRingMagic[8] = { 'O', 'D', 'I', 'N', 'R', 'N', 'G', '1' };
+constexpr size_t kRingIdOffset = 16;
+constexpr size_t kRingHeaderSize = 64;
+
+// Each record starts with its sequence, size and state, 8 byte aligned
+constexpr size_t kRecordHeaderSize = 16;
+constexpr size_t kSequenceOffset = 0;
+constexpr size_t kSizeOffset = 8;
+constexpr size_t kStateOffset = 12;
+
+enum RecordState : uint32_t {
+  kWritten = 1,
+  kReleased = 2,
+  kOpened = 3
+};
+
+// A handle is its magic, the ring id, the record offset, sequence and size,
+// then the name of the ring
+constexpr char kHandleMagic[8] = { 'O', 'D', 'I', 'N', 'S', 'H', 'M', '1' };
+constexpr size_t kHandleHeaderSize = sizeof(kHandleMagic) + 3 * sizeof(uint64_t)
+    + sizeof(uint32_t);
+
+std::atomic<uint32_t>& State(char* record) {
+  static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+                "The record state must be a plain 32 bit word");
+  return *reinterpret_cast<std::atomic<uint32_t>*>(record + kStateOffset);
+}
+
+template <class T>
+T ReadValue(const char* bytes) {
+  T value;
+  std::memcpy(&value, bytes, sizeof(value));
+  return value;
+}
+
+template <class T>
+void WriteValue(char* bytes, const T& value) {
+  std::memcpy(bytes, &value, sizeof(value));
+}
+
+template <class T>
+void Append(std::string& bytes, const T& value) {
+  bytes.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+size_t Align(size_t size) {
+  return (size + 7) & ~static_cast<size_t>(7);
+}
+
+// The rings this process has mapped to read trip paths from. A ring that was
+// recreated under the same name is mapped again, the old mapping is unmapped
+// once none of its trip paths is open any more.
+struct mapping_t {
+  std::string name;
+  char* data;
+  size_t size;
+  // The trip paths of the mapping that are open
+  size_t open_count;
+  // Whether the ring was mapped again since
+  bool replaced;
+};
+
+std::mutex mappings_mutex;
+std::list<mapping_t> mappings;
+
+uint64_t GetRingId(const mapping_t& mapping) {
+  return ReadValue<uint64_t>(mapping.data + kRingIdOffset);
+}
+
+// Returns the current mapping of the named ring with one more open trip path
+mapping_t& OpenMapping(const std::string& name, uint64_t ring_id) {
+  std::lock_guard<std::mutex> lock(mappings_mutex);
+  auto found = std::find_if(mappings.begin(), mappings.end(),
+                            [&name](const mapping_t& mapping) {
+                              return !mapping.replaced
+                                  && (mapping.name == name);
+                            });
+  if (found != mappings.end()) {
+    if (GetRingId(*found) == ring_id) {
+      ++found->open_count;
+      return *found;
+    }
+    found->replaced = true;
+    if (found->open_count == 0) {
+      munmap(found->data, found->size);
+      mappings.erase(found);
+    }
+  }
+
+  int fd = shm_open(name.c_str(), O_RDWR, 0);
+  if (fd < 0) {
+    throw std::runtime_error("Cannot open the shared trip paths " + name);
+  }
+  struct stat status;
+  void* data = MAP_FAILED;
+  if ((fstat(fd, &status) == 0)
+      && (static_cast<size_t>(status.st_size) > kRingHeaderSize)) {
+    data = mmap(nullptr, status.st_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                fd, 0);
+  }
+  close(fd);
+  if ((data == MAP_FAILED)
+      || (std::memcmp(data, kRingMagic, sizeof(kRingMagic)) != 0)) {
+    if (data != MAP_FAILED) {
+      munmap(data, status.st_size);
+    }
+    throw std::runtime_error("Not a shared trip path ring " + name);
+  }
+
+  mappings.push_back({ name, static_cast<char*>(data),
+                       static_cast<size_t>(status.st_size), 1, false });
+  return mappings.back();
+}
+
+// Closes a trip path of the mapping starting at the specified data
+void CloseMapping(const char* data) {
+  std::lock_guard<std::mutex> lock(mappings_mutex);
+  auto found = std::find_if(mappings.begin(), mappings.end(),
+                            [data](const mapping_t& mapping) {
+                              return mapping.data == data;
+                            });
+  if ((found != mappings.end()) && (--found->open_count == 0)
+      && found->replaced) {
+    munmap(found->data, found->size);
+    mappings.erase(found);
+  }
+}
+
+}
+
+namespace valhalla {
+namespace odin {
+
+SharedTripPathRing::SharedTripPathRing(const std::string& name,
+                                       size_t capacity)
+    : name_(name),
+      capacity_(Align(capacity)),
+      mapping_(nullptr),
+      mapping_size_(kRingHeaderSize + capacity_),
+      head_(0),
+      tail_(0),
+      used_(0),
+      sequence_(0),
+      ring_id_(0) {
+  // Replace whatever a previous writer left behind
+  shm_unlink(name_.c_str());
+  int fd = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) {
+    throw std::runtime_error("Cannot create the shared trip paths " + name_);
+  }
+  void* data = MAP_FAILED;
+  if (ftruncate(fd, mapping_size_) == 0) {
+    data = mmap(nullptr, mapping_size_, PROT_READ | PROT_WRITE, MAP_SHARED,
+                fd, 0);
+  }
+  close(fd);
+  if (data == MAP_FAILED) {
+    shm_unlink(name_.c_str());
+    throw std::runtime_error("Cannot map the shared trip paths " + name_);
+  }
+
+  mapping_ = static_cast<char*>(data);
+  std::memcpy(mapping_, kRingMagic, sizeof(kRingMagic));
+  WriteValue<uint64_t>(mapping_ + sizeof(kRingMagic), capacity_);
+  ring_id_ = std::chrono::system_clock::now().time_since_epoch().count()
+      ^ (static_cast<uint64_t>(getpid()) << 40);
+  WriteValue<uint64_t>(mapping_ + kRingIdOffset, ring_id_);
+}
+
+SharedTripPathRing::~SharedTripPathRing() {
+  munmap(mapping_, mapping_size_);
+  shm_unlink(name_.c_str());
+}
+
+bool SharedTripPathRing::Write(const char* trip_path, size_t size,
+                               std::string& handle) {
+  size_t record_size = Align(kRecordHeaderSize + size);
+  if ((record_size > capacity_) || (size > UINT32_MAX)) {
+    return false;
+  }
+
+  // Records do not wrap, skip the end of the ring if the record does not fit
+  Reclaim();
+  size_t offset = head_;
+  size_t skipped = 0;
+  if (offset + record_size > capacity_) {
+    skipped = capacity_ - offset;
+    offset = 0;
+  }
+  if (used_ + skipped + record_size > capacity_) {
+    return false;
+  }
+
+  char* records = mapping_ + kRingHeaderSize;
+  if (skipped >= kRecordHeaderSize) {
+    char* padding = records + head_;
+    WriteValue<uint64_t>(padding + kSequenceOffset, 0);
+    WriteValue<uint32_t>(padding + kSizeOffset, skipped - kRecordHeaderSize);
+    State(padding).store(kReleased, std::memory_order_release);
+  }
+
+  char* record = records + offset;
+  WriteValue<uint64_t>(record + kSequenceOffset, ++sequence_);
+  WriteValue<uint32_t>(record + kSizeOffset, size);
+  std::memcpy(record + kRecordHeaderSize, trip_path, size);
+  State(record).store(kWritten, std::memory_order_release);
+  head_ = offset + record_size;
+  used_ += skipped + record_size;
+
+  handle.assign(kHandleMagic, sizeof(kHandleMagic));
+  Append<uint64_t>(handle, ring_id_);
+  Append<uint64_t>(handle, offset);
+  Append<uint64_t>(handle, sequence_);
+  Append<uint32_t>(handle, size);
+  handle.append(name_);
+  return true;
+}
+
+size_t SharedTripPathRing::used() {
+  Reclaim();
+  return used_;
+}
+
+const std::string& SharedTripPathRing::name() const {
+  return name_;
+}
+
+size_t SharedTripPathRing::capacity() const {
+  return capacity_;
+}
+
+void SharedTripPathRing::Reclaim() {
+  char* records = mapping_ + kRingHeaderSize;
+  while (used_ > 0) {
+    // The end of the ring too small for a record was skipped
+    if (capacity_ - tail_ < kRecordHeaderSize) {
+      used_ -= capacity_ - tail_;
+      tail_ = 0;
+      continue;
+    }
+    char* record = records + tail_;
+    if (State(record).load(std::memory_order_acquire) != kReleased) {
+      break;
+    }
+    size_t record_size = Align(kRecordHeaderSize
+        + ReadValue<uint32_t>(record + kSizeOffset));
+    tail_ += record_size;
+    used_ -= record_size;
+    if (tail_ == capacity_) {
+      tail_ = 0;
+    }
+  }
+  if (used_ == 0) {
+    head_ = tail_ = 0;
+  }
+}
+
+bool SharedTripPath::IsHandle(const char* frame, size_t size) {
+  return (size > kHandleHeaderSize)
+      && (std::memcmp(frame, kHandleMagic, sizeof(kHandleMagic)) == 0);
+}
+
+SharedTripPath SharedTripPath::Open(const char* frame, size_t size) {
+  if (!IsHandle(frame, size)) {
+    throw std::runtime_error("Not a shared trip path handle");
+  }
+  const char* fields = frame + sizeof(kHandleMagic);
+  auto ring_id = ReadValue<uint64_t>(fields);
+  auto offset = ReadValue<uint64_t>(fields + sizeof(uint64_t));
+  auto sequence = ReadValue<uint64_t>(fields + 2 * sizeof(uint64_t));
+  auto path_size = ReadValue<uint32_t>(fields + 3 * sizeof(uint64_t));
+  std::string name(frame + kHandleHeaderSize, size - kHandleHeaderSize);
+
+  // The record must still be the one the handle was made for. The mapping
+  // stays open until the trip path is released.
+  auto& mapping = OpenMapping(name, ring_id);
+  char* mapping_data = mapping.data;
+  auto fail = [mapping_data](const std::string& message) {
+    CloseMapping(mapping_data);
+    throw std::runtime_error(message);
+  };
+  if (GetRingId(mapping) != ring_id) {
+    fail("Shared trip path ring was replaced " + name);
+  }
+  size_t capacity = mapping.size - kRingHeaderSize;
+  if ((offset > capacity)
+      || (kRecordHeaderSize + path_size > capacity - offset)) {
+    fail("Shared trip path is out of its ring");
+  }
+  char* record = mapping_data + kRingHeaderSize + offset;
+  auto is_record = [record, sequence, path_size]() {
+    return (ReadValue<uint64_t>(record + kSequenceOffset) == sequence)
+        && (ReadValue<uint32_t>(record + kSizeOffset) == path_size);
+  };
+  if (!is_record()) {
+    fail("Shared trip path is no longer available");
+  }
+
+  // Claim the record so a second open of the handle cannot release it while
+  // it is read. If it was released and rewritten since it was checked the
+  // new record is given back to its own handle.
+  uint32_t state = kWritten;
+  if (!State(record).compare_exchange_strong(state, kOpened,
+                                             std::memory_order_acquire)) {
+    fail("Shared trip path is no longer available");
+  }
+  if (!is_record()) {
+    State(record).store(kWritten, std::memory_order_release);
+    fail("Shared trip path is no longer available");
+  }
+  return SharedTripPath(mapping_data, record, path_size);
+}
+
+SharedTripPath::SharedTripPath(char* mapping, char* record, size_t size)
+    : mapping_(mapping),
+      record_(record),
+      size_(size) {
+}
+
+SharedTripPath::SharedTripPath(SharedTripPath&& other)
+    : mapping_(other.mapping_),
+      record_(other.record_),
+      size_(other.size_) {
+  other.record_ = nullptr;
+}
+
+SharedTripPath& SharedTripPath::operator=(SharedTripPath&& other) {
+  if (this != &other) {
+    Release();
+    mapping_ = other.mapping_;
+    record_ = other.record_;
+    size_ = other.size_;
+    other.record_ = nullptr;
+  }
+  return *this;
+}
+
+SharedTripPath::~SharedTripPath() {
+  Release();
+}
+
+const char* SharedTripPath::data() const {
+  return record_ + kRecordHeaderSize;
+}
+
+size_t SharedTripPath::size() const {
+  return size_;
+}
+
+void SharedTripPath::Release() {
+  if (record_) {
+    State(record_).store(kReleased, std::memory_order_release);
+    CloseMapping(mapping_);
+    record_ = nullptr;
+  }
+}
+
+TripPathFrames::TripPathFrames()
+    : opened_(true) {
+}
+
+void TripPathFrames::Add(const char* frame, size_t size) {
+  if (!SharedTripPath::IsHandle(frame, size)) {
+    frames_.push_back({ frame, size, frame, size });
+    return;
+  }
+
+  // A handle repeated within the job refers to the record already opened
+  for (const auto& added : frames_) {
+    if ((added.size == size) && (std::memcmp(added.data, frame, size) == 0)) {
+      frames_.push_back(added);
+      return;
+    }
+  }
+
+  try {
+    trip_paths_.emplace_back(SharedTripPath::Open(frame, size));
+    frames_.push_back({ frame, size, trip_paths_.back().data(),
+                        trip_paths_.back().size() });
+  } catch (const std::exception&) {
+    frames_.push_back({ frame, size, nullptr, 0 });
+    opened_ = false;
+  }
+}
+
+bool TripPathFrames::opened() const {
+  return opened_;
+}
+
+size_t TripPathFrames::size() const {
+  return frames_.size();
+}
+
+const char* TripPathFrames::data(size_t index) const {
+  return frames_[index].trip_path;
+}
+
+size_t TripPathFrames::size(size_t index) const {
+  return frames_[index].trip_path_size;
+}
+
+void TripPathFrames::Release() {
+  trip_paths_.clear();
+  for (auto& frame : frames_) {
+    if (frame.trip_path != frame.data) {
+      frame.trip_path = nullptr;
+      frame.trip_path_size = 0;
+    }
+  }
+}
+
+}
+}
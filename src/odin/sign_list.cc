@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "odin/sign_list.h"
+
+namespace valhalla {
+namespace odin {
+
+constexpr uint32_t SignList::kInlineCapacity;
+
+SignList::SignList()
+    : data_(InlineData()),
+      size_(0),
+      capacity_(kInlineCapacity) {
+}
+
+SignList::SignList(const SignList& other)
+    : SignList() {
+  *this = other;
+}
+
+SignList::SignList(SignList&& other)
+    : SignList() {
+  MoveFrom(other);
+}
+
+SignList::~SignList() {
+  clear();
+  if (!IsInline()) {
+    ::operator delete(data_);
+  }
+}
+
+SignList& SignList::operator =(const SignList& other) {
+  if (this != &other) {
+    clear();
+    if (other.size_ > capacity_) {
+      Reserve(other.size_);
+    }
+    for (const auto& sign : other) {
+      new (data_ + size_) Sign(sign);
+      ++size_;
+    }
+  }
+  return *this;
+}
+
+SignList& SignList::operator =(SignList&& other) {
+  if (this != &other) {
+    clear();
+    MoveFrom(other);
+  }
+  return *this;
+}
+
+Sign& SignList::at(size_t index) {
+  if (index >= size_) {
+    throw std::out_of_range("SignList index out of range");
+  }
+  return data_[index];
+}
+
+const Sign& SignList::at(size_t index) const {
+  if (index >= size_) {
+    throw std::out_of_range("SignList index out of range");
+  }
+  return data_[index];
+}
+
+void SignList::clear() {
+  for (auto& sign : *this) {
+    sign.~Sign();
+  }
+  size_ = 0;
+}
+
+bool SignList::operator ==(const SignList& rhs) const {
+  return (size_ == rhs.size_) && std::equal(begin(), end(), rhs.begin());
+}
+
+bool SignList::operator !=(const SignList& rhs) const {
+  return !(*this == rhs);
+}
+
+Sign* SignList::InlineData() {
+  return reinterpret_cast<Sign*>(inline_signs_);
+}
+
+bool SignList::IsInline() const {
+  return (data_ == reinterpret_cast<const Sign*>(inline_signs_));
+}
+
+void SignList::Reserve(uint32_t capacity) {
+  Sign* data = static_cast<Sign*>(::operator new(capacity * sizeof(Sign)));
+  for (uint32_t i = 0; i < size_; ++i) {
+    new (data + i) Sign(std::move(data_[i]));
+    data_[i].~Sign();
+  }
+  if (!IsInline()) {
+    ::operator delete(data_);
+  }
+  data_ = data;
+  capacity_ = capacity;
+}
+
+void SignList::MoveFrom(SignList& other) {
+  // A heap buffer is taken over, inline signs are moved one by one
+  if (!other.IsInline()) {
+    if (!IsInline()) {
+      ::operator delete(data_);
+    }
+    data_ = other.data_;
+    size_ = other.size_;
+    capacity_ = other.capacity_;
+    other.data_ = other.InlineData();
+    other.size_ = 0;
+    other.capacity_ = kInlineCapacity;
+    return;
+  }
+  for (auto& sign : other) {
+    new (data_ + size_) Sign(std::move(sign));
+    ++size_;
+  }
+  other.clear();
+}
+
+}
+}
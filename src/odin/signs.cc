@@ -11,11 +11,11 @@ namespace odin {
 Signs::Signs() {
 }
 
-const std::vector<Sign>& Signs::exit_number_list() const {
+const SignList& Signs::exit_number_list() const {
   return exit_number_list_;
 }
 
-std::vector<Sign>* Signs::mutable_exit_number_list() {
+SignList* Signs::mutable_exit_number_list() {
   return &exit_number_list_;
 }
 
@@ -26,11 +26,11 @@ const std::string Signs::GetExitNumberString(
                       delim, verbal_formatter);
 }
 
-const std::vector<Sign>& Signs::exit_branch_list() const {
+const SignList& Signs::exit_branch_list() const {
   return exit_branch_list_;
 }
 
-std::vector<Sign>* Signs::mutable_exit_branch_list() {
+SignList* Signs::mutable_exit_branch_list() {
   return &exit_branch_list_;
 }
 
@@ -41,11 +41,11 @@ const std::string Signs::GetExitBranchString(
                       delim, verbal_formatter);
 }
 
-const std::vector<Sign>& Signs::exit_toward_list() const {
+const SignList& Signs::exit_toward_list() const {
   return exit_toward_list_;
 }
 
-std::vector<Sign>* Signs::mutable_exit_toward_list() {
+SignList* Signs::mutable_exit_toward_list() {
   return &exit_toward_list_;
 }
 
@@ -56,11 +56,11 @@ const std::string Signs::GetExitTowardString(
                       delim, verbal_formatter);
 }
 
-const std::vector<Sign>& Signs::exit_name_list() const {
+const SignList& Signs::exit_name_list() const {
   return exit_name_list_;
 }
 
-std::vector<Sign>* Signs::mutable_exit_name_list() {
+SignList* Signs::mutable_exit_name_list() {
   return &exit_name_list_;
 }
 
@@ -129,7 +129,7 @@ std::string Signs::ToParameterString() const {
 }
 
 const std::string Signs::ListToString(
-    const std::vector<Sign>& signs, uint32_t max_count,
+    const SignList& signs, uint32_t max_count,
     bool limit_by_consecutive_count, std::string delim,
     const VerbalTextFormatter* verbal_formatter) const {
   std::string sign_string;
@@ -173,7 +173,7 @@ const std::string Signs::ListToString(
 }
 
 const std::string Signs::ListToParameterString(
-    const std::vector<Sign>& signs) const {
+    const SignList& signs) const {
   const std::string delim = ", ";
   std::string sign_string;
   bool is_first = true;
@@ -0,0 +1,63 @@
+#include "odin/stage_times.h"
+
+namespace {
+
+constexpr const char* kStageNames[] = {
+  "update_heading",
+  "produce",
+  "combine",
+  "narrative",
+  "populate"
+};
+
+}
+
+namespace valhalla {
+namespace odin {
+
+StageTimes::StageTimes() {
+  Clear();
+}
+
+const char* StageTimes::GetStageName(Stage stage) {
+  return kStageNames[stage];
+}
+
+void StageTimes::Add(Stage stage, uint64_t nanoseconds) {
+  nanoseconds_[stage] += nanoseconds;
+}
+
+uint64_t StageTimes::Get(Stage stage) const {
+  return nanoseconds_[stage];
+}
+
+uint64_t StageTimes::GetTotal() const {
+  uint64_t total = 0;
+  for (auto nanoseconds : nanoseconds_) {
+    total += nanoseconds;
+  }
+  return total;
+}
+
+void StageTimes::Clear() {
+  nanoseconds_.fill(0);
+}
+
+ScopedStageTimer::ScopedStageTimer(StageTimes* stage_times,
+                                   StageTimes::Stage stage)
+    : stage_times_(stage_times),
+      stage_(stage) {
+  if (stage_times_) {
+    start_ = clock_t::now();
+  }
+}
+
+ScopedStageTimer::~ScopedStageTimer() {
+  if (stage_times_) {
+    stage_times_->Add(stage_, std::chrono::duration_cast<
+        std::chrono::nanoseconds>(clock_t::now() - start_).count());
+  }
+}
+
+}
+}
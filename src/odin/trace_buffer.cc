@@ -0,0 +1,150 @@
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+
+#include <boost/format.hpp>
+
+#include "odin/trace_buffer.h"
+
+namespace {
+
+// Header of a binary trace: magic, event size, event count, dropped count
+constexpr char kMagic[8] = { 'O', 'D', 'I', 'N', 'T', 'R', 'C', '1' };
+constexpr size_t kHeaderSize = sizeof(kMagic) + 2 * sizeof(uint32_t)
+    + sizeof(uint64_t);
+
+constexpr const char* kTypeNames[] = {
+  "none",
+  "node",
+  "intersecting_edge",
+  "right_xedge_counts",
+  "left_xedge_counts",
+  "maneuver_update",
+  "maneuver_begin",
+  "combine",
+  "maneuver",
+  "combined_maneuver"
+};
+
+constexpr const char* kCombineDecisionNames[] = {
+  "collapse_transit_connection_start",
+  "collapse_transit_connection_destination",
+  "no_combine_transit_connection",
+  "no_combine_travel_mode_or_destination",
+  "no_combine_fork_or_tee",
+  "no_combine_ferry",
+  "combine_internal",
+  "combine_turn_channel",
+  "no_combine_intersecting_forward_edge",
+  "no_combine_travel_type",
+  "combine_same_name_straight",
+  "combine_unnamed_straight",
+  "no_combine"
+};
+
+template <class T>
+void Append(std::string& bytes, const T& value) {
+  bytes.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+}
+
+namespace valhalla {
+namespace odin {
+
+constexpr size_t TraceBuffer::kDefaultCapacity;
+
+TraceBuffer::TraceBuffer(size_t capacity)
+    : events_(std::max(capacity, static_cast<size_t>(1))),
+      count_(0) {
+}
+
+void TraceBuffer::Add(TraceEvent::Type type, uint16_t code,
+                      uint32_t node_index, int32_t value0, int32_t value1,
+                      int32_t value2, int32_t value3) {
+  TraceEvent& event = events_[count_ % events_.size()];
+  event.type = type;
+  event.code = code;
+  event.node_index = node_index;
+  event.values[0] = value0;
+  event.values[1] = value1;
+  event.values[2] = value2;
+  event.values[3] = value3;
+  ++count_;
+}
+
+std::vector<TraceEvent> TraceBuffer::GetEvents() const {
+  std::vector<TraceEvent> events;
+  events.reserve(size());
+  for (uint64_t i = dropped(); i < count_; ++i) {
+    events.push_back(events_[i % events_.size()]);
+  }
+  return events;
+}
+
+std::string TraceBuffer::Serialize() const {
+  std::string bytes(kMagic, sizeof(kMagic));
+  Append(bytes, static_cast<uint32_t>(sizeof(TraceEvent)));
+  Append(bytes, static_cast<uint32_t>(size()));
+  Append(bytes, dropped());
+  for (const auto& event : GetEvents()) {
+    Append(bytes, event);
+  }
+  return bytes;
+}
+
+std::vector<TraceEvent> TraceBuffer::Deserialize(const std::string& trace) {
+  if ((trace.size() < kHeaderSize)
+      || (std::memcmp(trace.data(), kMagic, sizeof(kMagic)) != 0)) {
+    throw std::runtime_error("Not an odin trace");
+  }
+
+  uint32_t event_size;
+  uint32_t event_count;
+  const char* bytes = trace.data() + sizeof(kMagic);
+  std::memcpy(&event_size, bytes, sizeof(event_size));
+  std::memcpy(&event_count, bytes + sizeof(event_size), sizeof(event_count));
+  if ((event_size != sizeof(TraceEvent))
+      || (trace.size() != kHeaderSize + event_count * sizeof(TraceEvent))) {
+    throw std::runtime_error("Incompatible or truncated odin trace");
+  }
+
+  std::vector<TraceEvent> events(event_count);
+  if (event_count > 0) {
+    std::memcpy(events.data(), trace.data() + kHeaderSize,
+                event_count * sizeof(TraceEvent));
+  }
+  return events;
+}
+
+std::string TraceBuffer::ToString(const TraceEvent& event) {
+  const char* type_name = (event.type < TraceEvent::kTypeCount) ?
+      kTypeNames[event.type] : "unknown";
+  std::string code = std::to_string(event.code);
+  if ((event.type == TraceEvent::kCombine)
+      && (event.code < TraceEvent::kCombineDecisionCount)) {
+    code = kCombineDecisionNames[event.code];
+  }
+  return (boost::format("%1% node=%2% code=%3% values=%4%,%5%,%6%,%7%")
+      % type_name % event.node_index % code % event.values[0]
+      % event.values[1] % event.values[2] % event.values[3]).str();
+}
+
+size_t TraceBuffer::capacity() const {
+  return events_.size();
+}
+
+size_t TraceBuffer::size() const {
+  return static_cast<size_t>(std::min<uint64_t>(count_, events_.size()));
+}
+
+uint64_t TraceBuffer::dropped() const {
+  return count_ - size();
+}
+
+void TraceBuffer::clear() {
+  count_ = 0;
+}
+
+}
+}
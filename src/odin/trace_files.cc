@@ -0,0 +1,52 @@
+#include <cstdio>
+#include <atomic>
+#include <fstream>
+#include <stdexcept>
+
+#include <unistd.h>
+
+#include "odin/trace_files.h"
+
+namespace valhalla {
+namespace odin {
+
+TraceFiles::TraceFiles(const std::string& directory, size_t max_files)
+    : directory_(directory),
+      max_files_(max_files) {
+  // Every worker names its own files so they never overwrite each other
+  static std::atomic<uint32_t> worker_count(0);
+  worker_ = worker_count++;
+}
+
+std::string TraceFiles::Write(uint64_t id, size_t leg_index,
+                              const TraceBuffer& trace) {
+  std::string file_name = directory_ + "/odin_trace_"
+      + std::to_string(getpid()) + "_" + std::to_string(worker_) + "_"
+      + std::to_string(id) + "_" + std::to_string(leg_index) + ".bin";
+  std::string bytes = trace.Serialize();
+  {
+    std::ofstream file(file_name, std::ios::binary | std::ios::trunc);
+    file.write(bytes.data(), bytes.size());
+    file.close();
+    if (!file) {
+      std::remove(file_name.c_str());
+      throw std::runtime_error("Cannot write the trace " + file_name);
+    }
+  }
+
+  // A file that was rewritten is now the newest
+  file_names_.remove(file_name);
+  file_names_.push_back(file_name);
+  while ((max_files_ > 0) && (file_names_.size() > max_files_)) {
+    std::remove(file_names_.front().c_str());
+    file_names_.pop_front();
+  }
+  return file_name;
+}
+
+const std::string& TraceFiles::directory() const {
+  return directory_;
+}
+
+}
+}
@@ -1,17 +1,30 @@
-#include <unordered_map>
-
 #include "proto/tripdirections.pb.h"
 #include "proto/directions_options.pb.h"
+#include "odin/enum_table.h"
 #include "odin/transitstop.h"
 #include "odin/util.h"
 
 namespace valhalla {
 namespace odin {
 
-const std::unordered_map<int, TripDirections_TransitStop_Type> translate_transit_stop_type {
-  { static_cast<int>(TripPath_TransitStopInfo_Type_kStop), TripDirections_TransitStop_Type_kStop },
-  { static_cast<int>(TripPath_TransitStopInfo_Type_kStation), TripDirections_TransitStop_Type_kStation },
-};
+constexpr EnumTable<TripPath_TransitStopInfo_Type, TripDirections_TransitStop_Type,
+                    TripPath_TransitStopInfo_Type_Type_ARRAYSIZE> translate_transit_stop_type {{
+  { TripPath_TransitStopInfo_Type_kStop, TripDirections_TransitStop_Type_kStop },
+  { TripPath_TransitStopInfo_Type_kStation, TripDirections_TransitStop_Type_kStation },
+}};
+static_assert(translate_transit_stop_type.IsDense(), "Every TripPath_TransitStopInfo_Type must be translated in order");
+
+TransitStop::TransitStop()
+    : type(TripDirections_TransitStop_Type_kStop),
+      is_parent_stop(false),
+      assumed_schedule(false),
+      lat(0.0f),
+      lng(0.0f),
+      arrival_local_time(kInvalidTransitTime),
+      departure_local_time(kInvalidTransitTime),
+      arrival_tz_offset(0),
+      departure_tz_offset(0) {
+}
 
 TransitStop::TransitStop(TripDirections_TransitStop_Type type,
                          std::string onestop_id,
@@ -23,14 +36,15 @@ TransitStop::TransitStop(TripDirections_TransitStop_Type type,
                          float lat,
                          float lng)
     : type(type),
-      onestop_id(onestop_id),
-      name(name),
-      arrival_date_time(arrival_date_time),
-      departure_date_time(departure_date_time),
+      onestop_id(std::move(onestop_id)),
+      name(std::move(name)),
+      arrival_date_time(std::move(arrival_date_time)),
+      departure_date_time(std::move(departure_date_time)),
       is_parent_stop(is_parent_stop),
-      assumed_schedule(assumed_schedule) {
-  ll.set_lat(lat);
-  ll.set_lng(lng);
+      assumed_schedule(assumed_schedule),
+      lat(lat),
+      lng(lng) {
+  ParseDateTimes();
 }
 
 TransitStop::TransitStop(TripPath_TransitStopInfo_Type type,
@@ -42,9 +56,36 @@ TransitStop::TransitStop(TripPath_TransitStopInfo_Type type,
                          bool assumed_schedule,
                          float lat,
                          float lng)
-    : TransitStop(translate_transit_stop_type.find(type)->second, onestop_id,
-                  name, arrival_date_time, departure_date_time, is_parent_stop,
-                  assumed_schedule, lat, lng) {
+    : TransitStop(translate_transit_stop_type[type],
+                  std::move(onestop_id), std::move(name),
+                  std::move(arrival_date_time), std::move(departure_date_time),
+                  is_parent_stop, assumed_schedule, lat, lng) {
+}
+
+TransitStop::TransitStop(const TripPath_TransitStopInfo& stop_info)
+    : type(translate_transit_stop_type[stop_info.type()]),
+      onestop_id(stop_info.onestop_id()),
+      name(stop_info.name()),
+      arrival_date_time(stop_info.arrival_date_time()),
+      departure_date_time(stop_info.departure_date_time()),
+      is_parent_stop(stop_info.is_parent_stop()),
+      assumed_schedule(stop_info.assumed_schedule()),
+      lat(stop_info.ll().lat()),
+      lng(stop_info.ll().lng()) {
+  ParseDateTimes();
+}
+
+void TransitStop::ParseDateTimes() {
+  if (!parse_date_time(arrival_date_time, arrival_local_time,
+                       arrival_tz_offset)) {
+    arrival_local_time = kInvalidTransitTime;
+    arrival_tz_offset = 0;
+  }
+  if (!parse_date_time(departure_date_time, departure_local_time,
+                       departure_tz_offset)) {
+    departure_local_time = kInvalidTransitTime;
+    departure_tz_offset = 0;
+  }
 }
 
 std::string TransitStop::ToParameterString() const {
@@ -74,10 +115,10 @@ std::string TransitStop::ToParameterString() const {
   str += std::to_string(assumed_schedule);
 
   str += delim;
-  str += std::to_string(ll.lat());
+  str += std::to_string(lat);
 
   str += delim;
-  str += std::to_string(ll.lng());
+  str += std::to_string(lng);
 
   str += " }";
 
@@ -1,3 +1,6 @@
+#include <cstring>
+#include <mutex>
+
 #include <boost/property_tree/json_parser.hpp>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
@@ -6,6 +9,7 @@
 #include <boost/date_time/local_time/local_time.hpp>
 
 #include <valhalla/midgard/logging.h>
+#include <valhalla/baldr/verbal_text_formatter_factory.h>
 
 #include "proto/directions_options.pb.h"
 #include "odin/util.h"
@@ -94,6 +98,13 @@ DirectionsOptions GetDirectionsOptions(const boost::property_tree::ptree& pt) {
     directions_options.set_language(*lang_ptr);
   }
 
+  auto langs_ptr = pt.get_child_optional("languages");
+  if (langs_ptr) {
+    for (const auto& lang : *langs_ptr) {
+      directions_options.add_languages(lang.second.get_value<std::string>());
+    }
+  }
+
   auto narr_ptr = pt.get_optional<bool>("narrative");
   if (narr_ptr) {
     directions_options.set_narrative(*narr_ptr);
@@ -102,37 +113,68 @@ DirectionsOptions GetDirectionsOptions(const boost::property_tree::ptree& pt) {
   return directions_options;
 }
 
-//Get the time from the inputed date.
-//date_time is in the format of 2015-05-06T08:00-05:00
-std::string get_localized_time(const std::string& date_time,
-                               const std::locale& locale) {
-  if (date_time.find("T") == std::string::npos) return "";
-
-  std::string datetime;
-  std::size_t found = date_time.find_last_of("+"); // remove tz offset
-  if (found != std::string::npos)
-    datetime = date_time.substr(0,found);
-  else {
-    found = date_time.find_last_of("-"); // remove tz offset
-    if (found != std::string::npos)
-      datetime = date_time.substr(0,found);
-    else return "";
+bool parse_date_time(const std::string& date_time,
+                     boost::posix_time::ptime& pt) {
+  // 2015-05-06T08:00 followed by an optional tz offset which is not used
+  const char* format = "dddd-dd-ddTdd:dd";
+  size_t length = std::strlen(format);
+  if (date_time.size() < length) return false;
+  for (size_t i = 0; i < length; ++i) {
+    if (format[i] == 'd') {
+      if (date_time[i] < '0' || date_time[i] > '9') return false;
+    } else if (date_time[i] != format[i]) {
+      return false;
+    }
   }
 
-  std::string time = datetime;
+  auto number = [&date_time](size_t pos, size_t count) {
+    int value = 0;
+    for (size_t i = pos; i < pos + count; ++i)
+      value = value * 10 + (date_time[i] - '0');
+    return value;
+  };
+  int hours = number(11, 2);
+  int minutes = number(14, 2);
+  if (hours > 24 || minutes > 59) return false;
+
   try {
-    // formatting for in and output
-    std::locale in_locale(std::locale::classic(), new boost::local_time::local_time_input_facet("%Y-%m-%dT%H:%M"));
-    std::stringstream in_stream; in_stream.imbue(in_locale);
-    std::locale out_locale(locale, new boost::posix_time::time_facet("%X"));
-    std::stringstream out_stream; out_stream.imbue(out_locale);
-
-    //parse the input
-    boost::posix_time::ptime pt;
-    in_stream.str(datetime);
-    in_stream >> pt;
-
-    //format the output
+    // An hour of 24 rolls over to the next day
+    pt = boost::posix_time::ptime(
+        boost::gregorian::date(number(0, 4), number(5, 2), number(8, 2)),
+        boost::posix_time::hours(hours) + boost::posix_time::minutes(minutes));
+  } catch (std::exception&) { return false; }
+  return true;
+}
+
+bool parse_date_time(const std::string& date_time, int64_t& local_time,
+                     int16_t& tz_offset) {
+  boost::posix_time::ptime pt;
+  if (!parse_date_time(date_time, pt)) return false;
+
+  static const boost::posix_time::ptime epoch(boost::gregorian::date(1970, 1, 1));
+  local_time = (pt - epoch).total_seconds();
+
+  // tz offset as +hh:mm or -hh:mm, anything else is treated as UTC
+  tz_offset = 0;
+  const size_t offset_pos = 16;
+  if (date_time.size() >= offset_pos + 6
+      && (date_time[offset_pos] == '+' || date_time[offset_pos] == '-')
+      && date_time[offset_pos + 3] == ':') {
+    const char* digits = date_time.c_str() + offset_pos;
+    for (size_t i : { 1, 2, 4, 5 })
+      if (digits[i] < '0' || digits[i] > '9') return true;
+    int minutes = ((digits[1] - '0') * 10 + (digits[2] - '0')) * 60
+        + (digits[4] - '0') * 10 + (digits[5] - '0');
+    tz_offset = (digits[0] == '-') ? -minutes : minutes;
+  }
+  return true;
+}
+
+std::string format_localized_time(const boost::posix_time::ptime& pt,
+                                  const std::locale& time_locale) {
+  std::string time;
+  try {
+    std::stringstream out_stream; out_stream.imbue(time_locale);
     out_stream << pt;
     time = out_stream.str();
 
@@ -158,44 +200,68 @@ std::string get_localized_time(const std::string& date_time,
   return time;
 }
 
-//Get the date from the inputed date.
+std::string format_localized_date(const boost::posix_time::ptime& pt,
+                                  const std::locale& date_locale) {
+  std::string date;
+  try {
+    std::stringstream out_stream; out_stream.imbue(date_locale);
+    out_stream << pt;
+    date = out_stream.str();
+  } catch (std::exception&) { return ""; }
+
+  boost::algorithm::trim(date);
+  return date;
+}
+
+//Get the time from the inputed date.
 //date_time is in the format of 2015-05-06T08:00-05:00
-std::string get_localized_date(const std::string& date_time,
+std::string get_localized_time(const std::string& date_time,
                                const std::locale& locale) {
-  if (date_time.find("T") == std::string::npos) return "";
-
-  std::string datetime;
-  std::size_t found = date_time.find_last_of("+"); // remove tz offset
-  if (found != std::string::npos)
-    datetime = date_time.substr(0,found);
-  else {
-    found = date_time.find_last_of("-"); // remove tz offset
-    if (found != std::string::npos)
-      datetime = date_time.substr(0,found);
-    else return "";
-  }
+  boost::posix_time::ptime pt;
+  if (!parse_date_time(date_time, pt)) return "";
 
-  std::string date = datetime;
-  try {
+  std::locale time_locale(locale, new boost::posix_time::time_facet("%X"));
+  return format_localized_time(pt, time_locale);
+}
 
-    // formatting for in and output
-    std::locale in_locale(std::locale::classic(), new boost::local_time::local_time_input_facet("%Y-%m-%dT%H:%M"));
-    std::stringstream in_stream; in_stream.imbue(in_locale);
-    std::locale out_locale(locale, new boost::posix_time::time_facet("%x"));
-    std::stringstream out_stream; out_stream.imbue(out_locale);
+//Get the time from the inputed date using the times formatted when the
+//dictionary was loaded.
+std::string get_localized_time(const std::string& date_time,
+                               const NarrativeDictionary& dictionary) {
+  boost::posix_time::ptime pt;
+  if (!parse_date_time(date_time, pt)) return "";
 
-    //parse the input
-    boost::posix_time::ptime pt;
-    in_stream.str(datetime);
-    in_stream >> pt;
+  return dictionary.GetLocalizedTime(pt.time_of_day().hours() * 60
+                                     + pt.time_of_day().minutes());
+}
 
-    //format the output
-    out_stream << pt;
-    date = out_stream.str();
-  } catch (std::exception& e) { return ""; }
+//Get the time from a local time in seconds since the epoch using the times
+//formatted when the dictionary was loaded.
+std::string get_localized_time(int64_t local_time,
+                               const NarrativeDictionary& dictionary) {
+  if (local_time < 0) return "";
 
-  boost::algorithm::trim(date);
-  return date;
+  return dictionary.GetLocalizedTime((local_time % 86400) / 60);
+}
+
+//Get the date from the inputed date.
+//date_time is in the format of 2015-05-06T08:00-05:00
+std::string get_localized_date(const std::string& date_time,
+                               const std::locale& locale) {
+  boost::posix_time::ptime pt;
+  if (!parse_date_time(date_time, pt)) return "";
+
+  std::locale date_locale(locale, new boost::posix_time::time_facet("%x"));
+  return format_localized_date(pt, date_locale);
+}
+
+//Get the date from the inputed date using the date facet of the dictionary.
+std::string get_localized_date(const std::string& date_time,
+                               const NarrativeDictionary& dictionary) {
+  boost::posix_time::ptime pt;
+  if (!parse_date_time(date_time, pt)) return "";
+
+  return format_localized_date(pt, dictionary.GetDateLocale());
 }
 
 const locales_singleton_t& get_locales() {
@@ -204,6 +270,30 @@ const locales_singleton_t& get_locales() {
   return locales;
 }
 
+const baldr::VerbalTextFormatter* get_verbal_text_formatter(
+    const std::string& country_code, const std::string& state_code) {
+  //formatters live for the life of the process, there is only one for
+  //each country and state
+  static std::mutex mutex;
+  static std::unordered_map<std::string,
+      std::unique_ptr<baldr::VerbalTextFormatter> > formatters;
+
+  std::string key = country_code;
+  key += '\0';
+  key += state_code;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto& formatter = formatters[key];
+  if (!formatter)
+    formatter = baldr::VerbalTextFormatterFactory::Create(country_code, state_code);
+  return formatter.get();
+}
+
+InstructionCache& get_instruction_cache() {
+  static InstructionCache cache;
+  return cache;
+}
+
 const std::unordered_map<std::string, std::string>& get_locales_json() {
   return locales_json;
 }
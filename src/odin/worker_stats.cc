@@ -0,0 +1,283 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#include "odin/worker_stats.h"
+#include "odin/util.h"
+
+namespace {
+
+constexpr const char* kRequestStageNames[] = {
+  "parse",
+  "serialize",
+  "request"
+};
+
+constexpr double kPercentiles[] = { 0.5, 0.9, 0.99 };
+constexpr const char* kPercentileNames[] = { "p50", "p90", "p99" };
+
+// Every stats of the process, the workers register their stats once
+struct registry_t {
+  std::mutex mutex;
+  std::vector<const valhalla::odin::WorkerStats*> stats;
+};
+
+registry_t& get_registry() {
+  static registry_t registry;
+  return registry;
+}
+
+// The supported locales in the order of the locale counters
+struct locale_index_t {
+  std::vector<std::string> names;
+  std::unordered_map<std::string, size_t> indexes;
+};
+
+const locale_index_t& get_locale_index() {
+  static const locale_index_t locale_index = []() {
+    locale_index_t index;
+    for (const auto& locale : valhalla::odin::get_locales()) {
+      index.names.push_back(locale.first);
+    }
+    std::sort(index.names.begin(), index.names.end());
+    for (size_t i = 0; i < index.names.size(); ++i) {
+      index.indexes.emplace(index.names[i], i);
+    }
+    return index;
+  }();
+  return locale_index;
+}
+
+uint64_t Load(const std::atomic<uint64_t>& counter) {
+  return counter.load(std::memory_order_relaxed);
+}
+
+}
+
+namespace valhalla {
+namespace odin {
+
+constexpr size_t LatencyHistogram::kBucketCount;
+constexpr uint32_t WorkerStats::kFirstErrorCode;
+constexpr size_t WorkerStats::kErrorCodeCount;
+
+LatencyHistogram::LatencyHistogram()
+    : sum_(0) {
+  for (auto& count : counts_) {
+    count.store(0, std::memory_order_relaxed);
+  }
+}
+
+void LatencyHistogram::Record(uint64_t nanoseconds) {
+  auto& count = counts_[GetBucket(nanoseconds)];
+  count.store(Load(count) + 1, std::memory_order_relaxed);
+  sum_.store(Load(sum_) + nanoseconds, std::memory_order_relaxed);
+}
+
+void LatencyHistogram::AddTo(counts_t& counts, uint64_t& sum) const {
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    counts[i] += Load(counts_[i]);
+  }
+  sum += Load(sum_);
+}
+
+size_t LatencyHistogram::GetBucket(uint64_t nanoseconds) {
+  if (nanoseconds < 4) {
+    return nanoseconds;
+  }
+
+  // Power of two and the next 2 bits
+  size_t exponent = 63 - __builtin_clzll(nanoseconds);
+  size_t bucket = (exponent - 1) * 4 + ((nanoseconds >> (exponent - 2)) & 3);
+  return std::min(bucket, kBucketCount - 1);
+}
+
+uint64_t LatencyHistogram::GetBucketLimit(size_t bucket) {
+  if (bucket < 4) {
+    return bucket;
+  }
+  size_t exponent = bucket / 4 + 1;
+  uint64_t mantissa = 4 + (bucket % 4);
+  return ((mantissa + 1) << (exponent - 2)) - 1;
+}
+
+uint64_t LatencyHistogram::GetPercentile(const counts_t& counts,
+                                         double percentile) {
+  uint64_t total = 0;
+  for (auto count : counts) {
+    total += count;
+  }
+  if (total == 0) {
+    return 0;
+  }
+
+  uint64_t rank = static_cast<uint64_t>(percentile * total);
+  uint64_t seen = 0;
+  for (size_t i = 0; i < kBucketCount; ++i) {
+    seen += counts[i];
+    if (seen > rank) {
+      return GetBucketLimit(i);
+    }
+  }
+  return GetBucketLimit(kBucketCount - 1);
+}
+
+WorkerStats::WorkerStats()
+    : requests_(0),
+      legs_(0),
+      nodes_(0),
+      maneuvers_(0),
+      locales_(get_locale_index().names.size()) {
+  for (auto& errors : errors_) {
+    errors.store(0, std::memory_order_relaxed);
+  }
+  for (auto& locale : locales_) {
+    locale.store(0, std::memory_order_relaxed);
+  }
+
+  auto& registry = get_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.stats.push_back(this);
+}
+
+WorkerStats::~WorkerStats() {
+  auto& registry = get_registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.stats.erase(std::remove(registry.stats.begin(),
+                                   registry.stats.end(), this),
+                       registry.stats.end());
+}
+
+void WorkerStats::Record(size_t histogram, uint64_t nanoseconds) {
+  histograms_[histogram].Record(nanoseconds);
+}
+
+void WorkerStats::Record(const StageTimes& stage_times) {
+  for (size_t stage = 0; stage < StageTimes::kStageCount; ++stage) {
+    histograms_[stage].Record(
+        stage_times.Get(static_cast<StageTimes::Stage>(stage)));
+  }
+}
+
+void WorkerStats::RecordRequest(const std::string& language) {
+  Increment(requests_);
+  const auto& indexes = get_locale_index().indexes;
+  auto found = indexes.find(language);
+  if (found != indexes.end()) {
+    Increment(locales_[found->second]);
+  }
+}
+
+void WorkerStats::RecordLeg(uint32_t node_count, uint32_t maneuver_count) {
+  Increment(legs_);
+  Increment(nodes_, node_count);
+  Increment(maneuvers_, maneuver_count);
+}
+
+void WorkerStats::RecordError(uint32_t error_code) {
+  size_t index = error_code - kFirstErrorCode;
+  if ((error_code >= kFirstErrorCode) && (index < kErrorCodeCount)) {
+    Increment(errors_[index]);
+  }
+}
+
+std::string WorkerStats::ToJson() {
+  // Sum the stats of every worker, the workers keep recording meanwhile
+  std::array<LatencyHistogram::counts_t, kHistogramCount> counts{};
+  std::array<uint64_t, kHistogramCount> sums{};
+  uint64_t requests = 0, legs = 0, nodes = 0, maneuvers = 0;
+  std::array<uint64_t, kErrorCodeCount> errors{};
+  const auto& locale_names = get_locale_index().names;
+  std::vector<uint64_t> locales(locale_names.size(), 0);
+  size_t worker_count;
+  {
+    auto& registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    worker_count = registry.stats.size();
+    for (const auto* stats : registry.stats) {
+      for (size_t h = 0; h < kHistogramCount; ++h) {
+        stats->histograms_[h].AddTo(counts[h], sums[h]);
+      }
+      requests += Load(stats->requests_);
+      legs += Load(stats->legs_);
+      nodes += Load(stats->nodes_);
+      maneuvers += Load(stats->maneuvers_);
+      for (size_t i = 0; i < kErrorCodeCount; ++i) {
+        errors[i] += Load(stats->errors_[i]);
+      }
+      for (size_t i = 0; i < locales.size(); ++i) {
+        locales[i] += Load(stats->locales_[i]);
+      }
+    }
+  }
+
+  std::ostringstream json;
+  json << std::fixed << std::setprecision(1);
+  json << "{\"workers\":" << worker_count << ",\"requests\":" << requests
+       << ",\"legs\":" << legs << ",\"nodes\":" << nodes
+       << ",\"maneuvers\":" << maneuvers << ",\"latency_us\":{";
+  for (size_t h = 0; h < kHistogramCount; ++h) {
+    uint64_t count = 0;
+    for (auto bucket_count : counts[h]) {
+      count += bucket_count;
+    }
+    json << (h ? "," : "") << '"' << GetHistogramName(h) << "\":{\"count\":"
+         << count << ",\"mean\":" << (count ? sums[h] / 1e3 / count : 0.0);
+    for (size_t p = 0; p < 3; ++p) {
+      json << ",\"" << kPercentileNames[p] << "\":"
+           << LatencyHistogram::GetPercentile(counts[h], kPercentiles[p]) / 1e3;
+    }
+    json << '}';
+  }
+  json << "},\"errors\":{";
+  bool first = true;
+  for (size_t i = 0; i < kErrorCodeCount; ++i) {
+    if (errors[i] > 0) {
+      json << (first ? "" : ",") << '"' << (kFirstErrorCode + i) << "\":"
+           << errors[i];
+      first = false;
+    }
+  }
+  json << "},\"locales\":{";
+  first = true;
+  for (size_t i = 0; i < locales.size(); ++i) {
+    if (locales[i] > 0) {
+      json << (first ? "" : ",") << '"' << locale_names[i] << "\":"
+           << locales[i];
+      first = false;
+    }
+  }
+  json << "}}";
+  return json.str();
+}
+
+bool WorkerStats::IsExportDue(uint32_t interval_seconds) {
+  static std::atomic<int64_t> next_export(0);
+  int64_t now = std::chrono::duration_cast<std::chrono::seconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+  int64_t due = next_export.load(std::memory_order_relaxed);
+  if (due == 0) {
+    // The first interval starts with the first request
+    next_export.compare_exchange_strong(due, now + interval_seconds);
+    return false;
+  }
+  return (now >= due) && next_export.compare_exchange_strong(
+      due, now + interval_seconds);
+}
+
+const char* WorkerStats::GetHistogramName(size_t histogram) {
+  if (histogram < StageTimes::kStageCount) {
+    return StageTimes::GetStageName(static_cast<StageTimes::Stage>(histogram));
+  }
+  return kRequestStageNames[histogram - StageTimes::kStageCount];
+}
+
+void WorkerStats::Increment(std::atomic<uint64_t>& counter, uint64_t value) {
+  counter.store(Load(counter) + value, std::memory_order_relaxed);
+}
+
+}
+}
@@ -0,0 +1,456 @@
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <boost/format.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser.hpp>
+#include <google/protobuf/descriptor.h>
+
+#include "proto/tripdirections.pb.h"
+#include "proto/directions_options.pb.h"
+#include "odin/directions_batch.h"
+#include "odin/util.h"
+
+using namespace valhalla::odin;
+using google::protobuf::FieldDescriptor;
+
+namespace {
+
+constexpr auto kUsage =
+    "usage: odin_batch <trip_paths|-> [--output file] [--format protobuf|jsonl]"
+    " [--threads N] [--chunk N] [--options json] [--options-per-leg] [--resume]\n"
+    "\n"
+    "Reads length delimited (varint size prefixed) serialized trip paths from a\n"
+    "file, which is mapped, or from stdin and writes the directions of each leg\n"
+    "in order. With --options-per-leg every trip path is preceded by its length\n"
+    "delimited DirectionsOptions, otherwise --options applies to every leg. The\n"
+    "protobuf output is length delimited TripDirections, empty for failed legs.\n"
+    "The jsonl output has one {\"leg\":...} object per line. A checkpoint is kept\n"
+    "next to the output after each chunk and --resume continues from it.";
+
+struct options_t {
+  std::string input;
+  std::string output;
+  bool jsonl = false;
+  uint32_t threads = std::max(std::thread::hardware_concurrency(), 1u);
+  size_t chunk = 10000;
+  DirectionsOptions directions_options;
+  bool options_per_leg = false;
+  bool resume = false;
+};
+
+options_t ParseOptions(int argc, char** argv) {
+  options_t options;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if ((arg == "-") || (arg.compare(0, 2, "--") != 0)) {
+      options.input = arg;
+      continue;
+    }
+    if (arg == "--options-per-leg") {
+      options.options_per_leg = true;
+      continue;
+    }
+    if (arg == "--resume") {
+      options.resume = true;
+      continue;
+    }
+    if (i + 1 >= argc)
+      throw std::runtime_error(kUsage);
+    std::string value = argv[++i];
+    if (arg == "--output") {
+      options.output = value;
+    } else if (arg == "--format") {
+      if (value == "jsonl")
+        options.jsonl = true;
+      else if (value != "protobuf")
+        throw std::runtime_error(kUsage);
+    } else if (arg == "--threads") {
+      options.threads = std::max(std::stoul(value), 1ul);
+    } else if (arg == "--chunk") {
+      options.chunk = std::max(std::stoul(value), 1ul);
+    } else if (arg == "--options") {
+      // The directions_options of a service request
+      std::stringstream stream(value);
+      boost::property_tree::ptree pt;
+      boost::property_tree::read_json(stream, pt);
+      options.directions_options = GetDirectionsOptions(pt);
+    } else {
+      throw std::runtime_error(kUsage);
+    }
+  }
+  if (options.input.empty())
+    throw std::runtime_error(kUsage);
+  if (options.resume && options.output.empty())
+    throw std::runtime_error("--resume needs an --output file");
+  return options;
+}
+
+// Length delimited records of a mapped file or of stdin. The records of a
+// mapped file are read in place, those of stdin are kept until NewChunk.
+class record_reader_t {
+ public:
+  explicit record_reader_t(const std::string& path)
+      : mapping_(nullptr), size_(0), offset_(0) {
+    if (path == "-")
+      return;
+
+    int fd = open(path.c_str(), O_RDONLY);
+    struct stat status;
+    if ((fd < 0) || (fstat(fd, &status) != 0))
+      throw std::runtime_error("Cannot open " + path);
+    size_ = status.st_size;
+    if (size_ > 0) {
+      void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data == MAP_FAILED) {
+        close(fd);
+        throw std::runtime_error("Cannot map " + path);
+      }
+      mapping_ = static_cast<const char*>(data);
+      madvise(data, size_, MADV_SEQUENTIAL);
+    }
+    close(fd);
+  }
+
+  ~record_reader_t() {
+    if (mapping_)
+      munmap(const_cast<char*>(mapping_), size_);
+  }
+
+  bool Next(const char*& data, size_t& size) {
+    uint64_t length;
+    if (!ReadVarint(length))
+      return false;
+    if (mapping_) {
+      if (length > size_ - offset_)
+        throw std::runtime_error("Truncated record at byte " + std::to_string(offset_));
+      data = mapping_ + offset_;
+    } else {
+      records_.emplace_back(length, '\0');
+      if (!std::cin.read(&records_.back()[0], length))
+        throw std::runtime_error("Truncated record at byte " + std::to_string(offset_));
+      data = records_.back().data();
+    }
+    size = length;
+    offset_ += length;
+    return true;
+  }
+
+  // Skips the records before the specified byte offset
+  void Skip(uint64_t offset) {
+    const char* data;
+    size_t size;
+    while ((offset_ < offset) && Next(data, size)) {
+    }
+    records_.clear();
+    if (offset_ != offset)
+      throw std::runtime_error("Cannot resume at byte " + std::to_string(offset));
+  }
+
+  void NewChunk() {
+    records_.clear();
+  }
+
+  uint64_t offset() const {
+    return offset_;
+  }
+
+ protected:
+  bool ReadVarint(uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      int byte;
+      if (mapping_) {
+        byte = (offset_ < size_) ? static_cast<uint8_t>(mapping_[offset_]) : -1;
+      } else {
+        byte = std::cin.get();
+      }
+      if (byte < 0) {
+        if (shift == 0)
+          return false;
+        throw std::runtime_error("Truncated size at byte " + std::to_string(offset_));
+      }
+      ++offset_;
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0)
+        return true;
+    }
+    throw std::runtime_error("Invalid size at byte " + std::to_string(offset_));
+  }
+
+  const char* mapping_;
+  size_t size_;
+  uint64_t offset_;
+  std::deque<std::string> records_;
+};
+
+void WriteVarint(uint64_t value, std::ostream& out) {
+  while (value >= 0x80) {
+    out.put(static_cast<char>((value & 0x7f) | 0x80));
+    value >>= 7;
+  }
+  out.put(static_cast<char>(value));
+}
+
+void WriteJsonString(const std::string& value, std::ostream& out) {
+  out << '"';
+  for (unsigned char c : value) {
+    if ((c == '"') || (c == '\\')) {
+      out << '\\' << c;
+    } else if (c < 0x20) {
+      out << boost::format("\\u%04x") % static_cast<int>(c);
+    } else {
+      out << c;
+    }
+  }
+  out << '"';
+}
+
+// Enough digits to read back the same value. JSON has no NaN or infinity so
+// those are written as null.
+template <class T>
+void WriteJsonNumber(T value, std::ostream& out) {
+  if (!std::isfinite(value)) {
+    out << "null";
+    return;
+  }
+  auto precision = out.precision(std::numeric_limits<T>::max_digits10);
+  out << value;
+  out.precision(precision);
+}
+
+void WriteJson(const google::protobuf::Message& message, std::ostream& out);
+
+// Writes a field value, the index-th one of a repeated field
+void WriteJsonValue(const google::protobuf::Message& message,
+                    const FieldDescriptor* field, int index, std::ostream& out) {
+  const auto* reflection = message.GetReflection();
+  bool repeated = field->is_repeated();
+  switch (field->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_INT32:
+      out << (repeated ? reflection->GetRepeatedInt32(message, field, index)
+                       : reflection->GetInt32(message, field));
+      break;
+    case FieldDescriptor::CPPTYPE_INT64:
+      out << (repeated ? reflection->GetRepeatedInt64(message, field, index)
+                       : reflection->GetInt64(message, field));
+      break;
+    case FieldDescriptor::CPPTYPE_UINT32:
+      out << (repeated ? reflection->GetRepeatedUInt32(message, field, index)
+                       : reflection->GetUInt32(message, field));
+      break;
+    case FieldDescriptor::CPPTYPE_UINT64:
+      out << (repeated ? reflection->GetRepeatedUInt64(message, field, index)
+                       : reflection->GetUInt64(message, field));
+      break;
+    case FieldDescriptor::CPPTYPE_DOUBLE:
+      WriteJsonNumber(repeated ? reflection->GetRepeatedDouble(message, field, index)
+                               : reflection->GetDouble(message, field), out);
+      break;
+    case FieldDescriptor::CPPTYPE_FLOAT:
+      WriteJsonNumber(repeated ? reflection->GetRepeatedFloat(message, field, index)
+                               : reflection->GetFloat(message, field), out);
+      break;
+    case FieldDescriptor::CPPTYPE_BOOL:
+      out << ((repeated ? reflection->GetRepeatedBool(message, field, index)
+                        : reflection->GetBool(message, field)) ? "true" : "false");
+      break;
+    case FieldDescriptor::CPPTYPE_ENUM:
+      WriteJsonString((repeated ? reflection->GetRepeatedEnum(message, field, index)
+                                : reflection->GetEnum(message, field))->name(), out);
+      break;
+    case FieldDescriptor::CPPTYPE_STRING:
+      WriteJsonString(repeated ? reflection->GetRepeatedString(message, field, index)
+                               : reflection->GetString(message, field), out);
+      break;
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      WriteJson(repeated ? reflection->GetRepeatedMessage(message, field, index)
+                         : reflection->GetMessage(message, field), out);
+      break;
+  }
+}
+
+// Writes the set fields of a message with their proto names
+void WriteJson(const google::protobuf::Message& message, std::ostream& out) {
+  const auto* reflection = message.GetReflection();
+  std::vector<const FieldDescriptor*> fields;
+  reflection->ListFields(message, &fields);
+  out << '{';
+  for (size_t i = 0; i < fields.size(); ++i) {
+    const auto* field = fields[i];
+    out << (i ? "," : "") << '"' << field->name() << "\":";
+    if (field->is_repeated()) {
+      out << '[';
+      for (int j = 0; j < reflection->FieldSize(message, field); ++j) {
+        if (j)
+          out << ',';
+        WriteJsonValue(message, field, j, out);
+      }
+      out << ']';
+    } else {
+      WriteJsonValue(message, field, -1, out);
+    }
+  }
+  out << '}';
+}
+
+// Progress of a run, saved after every chunk that was written
+struct checkpoint_t {
+  uint64_t legs = 0;
+  uint64_t input_offset = 0;
+  uint64_t output_bytes = 0;
+};
+
+bool ReadCheckpoint(const std::string& path, checkpoint_t& checkpoint) {
+  std::ifstream file(path);
+  return static_cast<bool>(file >> checkpoint.legs >> checkpoint.input_offset
+                                >> checkpoint.output_bytes);
+}
+
+void WriteCheckpoint(const std::string& path, const checkpoint_t& checkpoint) {
+  // Replaced at once so a crash never leaves half of a checkpoint
+  std::string temporary = path + ".tmp";
+  {
+    std::ofstream file(temporary, std::ios::trunc);
+    file << checkpoint.legs << ' ' << checkpoint.input_offset << ' '
+         << checkpoint.output_bytes << std::endl;
+    if (!file)
+      throw std::runtime_error("Cannot write " + temporary);
+  }
+  if (std::rename(temporary.c_str(), path.c_str()) != 0)
+    throw std::runtime_error("Cannot write " + path);
+}
+
+}
+
+int main(int argc, char** argv) {
+  options_t options;
+  try {
+    options = ParseOptions(argc, argv);
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  try {
+    record_reader_t reader(options.input);
+
+    // Continue after the last chunk that was completely written
+    checkpoint_t checkpoint;
+    std::string checkpoint_path = options.output + ".checkpoint";
+    if (options.resume && ReadCheckpoint(checkpoint_path, checkpoint)) {
+      if (truncate(options.output.c_str(), checkpoint.output_bytes) != 0)
+        throw std::runtime_error("Cannot truncate " + options.output);
+      reader.Skip(checkpoint.input_offset);
+      std::cerr << "Resuming at leg " << checkpoint.legs << std::endl;
+    } else {
+      checkpoint = checkpoint_t();
+    }
+
+    std::ofstream file;
+    if (!options.output.empty()) {
+      file.open(options.output, std::ios::binary
+          | (checkpoint.legs ? std::ios::app : std::ios::trunc));
+      if (!file)
+        throw std::runtime_error("Cannot open " + options.output);
+    }
+    std::ostream& out = options.output.empty() ? std::cout : file;
+
+    DirectionsBatch batch(options.threads);
+    auto start = std::chrono::steady_clock::now();
+    uint64_t legs = 0, errors = 0;
+    const char* data;
+    size_t size;
+    bool done = false;
+    while (!done) {
+      // Read a chunk of legs and their options
+      batch.clear();
+      reader.NewChunk();
+      size_t options_index = options.options_per_leg ? 0
+          : batch.AddOptions(options.directions_options);
+      while (batch.size() < options.chunk) {
+        if (!reader.Next(data, size)) {
+          done = true;
+          break;
+        }
+        if (options.options_per_leg) {
+          DirectionsOptions directions_options;
+          if (!directions_options.ParseFromArray(data, static_cast<int>(size))
+              || !reader.Next(data, size))
+            throw std::runtime_error("Invalid options of leg "
+                + std::to_string(checkpoint.legs + batch.size()));
+          options_index = batch.AddOptions(directions_options);
+        }
+        batch.Add(options_index, data, size);
+      }
+
+      if (batch.size() == 0)
+        break;
+
+      // Build them across the threads and write them in order
+      batch.Build();
+      for (size_t i = 0; i < batch.size(); ++i) {
+        const auto& result = batch.GetResult(i);
+        uint64_t leg = checkpoint.legs + i;
+        errors += (result.error_code != 0);
+        if (!options.jsonl) {
+          WriteVarint(result.directions.size(), out);
+          out.write(result.directions.data(), result.directions.size());
+        } else if (result.error_code) {
+          out << "{\"leg\":" << leg << ",\"error_code\":" << result.error_code
+              << "}\n";
+        } else {
+          TripDirections trip_directions;
+          trip_directions.ParseFromString(result.directions);
+          out << "{\"leg\":" << leg << ",\"directions\":";
+          WriteJson(trip_directions, out);
+          out << "}\n";
+        }
+      }
+      out.flush();
+      if (!out)
+        throw std::runtime_error("Cannot write the directions");
+
+      checkpoint.legs += batch.size();
+      legs += batch.size();
+      checkpoint.input_offset = reader.offset();
+      if (!options.output.empty()) {
+        checkpoint.output_bytes = file.tellp();
+        WriteCheckpoint(checkpoint_path, checkpoint);
+      }
+
+      double seconds = std::chrono::duration<double>(
+          std::chrono::steady_clock::now() - start).count();
+      std::cerr << boost::format("%1% legs, %2% errors, %3$.1f legs/s")
+          % checkpoint.legs % errors % (seconds > 0 ? legs / seconds : 0.0)
+          << std::endl;
+    }
+
+    // A finished run starts over next time
+    if (!options.output.empty())
+      std::remove(checkpoint_path.c_str());
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
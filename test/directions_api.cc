@@ -0,0 +1,109 @@
+#include <string>
+
+#include <valhalla/baldr/errorcode_util.h>
+
+#include "proto/trippath.pb.h"
+#include "odin/directions_api.h"
+#include "odin/directions_api_c.h"
+
+#include "test.h"
+
+using namespace valhalla::odin;
+
+namespace {
+
+// A straight drive along Main Street
+std::string MakeTripPath() {
+  TripPath path;
+  for (int i = 0; i < 4; ++i) {
+    auto* node = path.add_node();
+    if (i < 3) {
+      auto* edge = node->mutable_edge();
+      edge->add_name("Main Street");
+      edge->set_length(0.5f);
+      edge->set_begin_heading(90);
+      edge->set_end_heading(90);
+      edge->set_travel_mode(TripPath_TravelMode_kDrive);
+      edge->set_begin_shape_index(i);
+      edge->set_end_shape_index(i + 1);
+    }
+  }
+  for (int i = 0; i < 2; ++i) {
+    auto* location = path.add_location();
+    location->mutable_ll()->set_lat(38.5f);
+    location->mutable_ll()->set_lng(-120.2f);
+  }
+  auto* admin = path.add_admin();
+  admin->set_country_code("US");
+  admin->set_state_code("PA");
+  path.set_shape("_p~iF~ps|U_ulLnnqC_mqNvxq`@");
+  return path.SerializeAsString();
+}
+
+const uint8_t* Bytes(const std::string& bytes) {
+  return reinterpret_cast<const uint8_t*>(bytes.data());
+}
+
+void TestBuildDirections() {
+  std::string trip_path = MakeTripPath();
+  DirectionsOptions options;
+  options.set_language("xx-XX");
+
+  // Unsupported languages fall back to the default language
+  auto directions = BuildDirections(Bytes(trip_path), trip_path.size(),
+                                    options);
+  if ((directions.maneuver_size() != 2)
+      || (directions.maneuver(0).text_instruction()
+          != "Drive east on Main Street."))
+    throw std::runtime_error("Incorrect directions");
+
+  OutputBuffer output;
+  BuildDirections(Bytes(trip_path), trip_path.size(), options, output);
+  if (std::string(reinterpret_cast<const char*>(output.data()), output.size())
+      != directions.SerializeAsString())
+    throw std::runtime_error("Incorrect serialized directions");
+
+  bool thrown = false;
+  try {
+    BuildDirections(Bytes(std::string("bad")), 3, options, output);
+  } catch (const valhalla::valhalla_exception_t& e) {
+    thrown = (e.error_code == 201);
+  }
+  if (!thrown)
+    throw std::runtime_error("Invalid trip path should throw 201");
+}
+
+void TestCApi() {
+  std::string trip_path = MakeTripPath();
+  odin_output_buffer* output = odin_output_buffer_new();
+
+  int error = odin_build_directions(Bytes(trip_path), trip_path.size(),
+                                    "{\"units\":\"miles\"}", output);
+  TripDirections directions;
+  if ((error != 0)
+      || !directions.ParseFromArray(odin_output_buffer_data(output),
+                                    odin_output_buffer_size(output))
+      || (directions.maneuver_size() != 2))
+    throw std::runtime_error("Incorrect directions from the C api");
+
+  // Failures are returned rather than thrown
+  if (odin_build_directions(Bytes(trip_path), trip_path.size(), "{units",
+                            output) != 299)
+    throw std::runtime_error("Invalid options should fail with 299");
+  if (odin_build_directions(Bytes(std::string("bad")), 3, nullptr, output)
+      != 201 || std::string(odin_error_message()).empty())
+    throw std::runtime_error("Invalid trip path should fail with 201");
+
+  odin_output_buffer_free(output);
+}
+
+}
+
+int main() {
+  test::suite suite("directions_api");
+
+  suite.test(TEST_CASE(TestBuildDirections));
+  suite.test(TEST_CASE(TestCApi));
+
+  return suite.tear_down();
+}
@@ -0,0 +1,140 @@
+#include <string>
+#include <vector>
+
+#include "proto/trippath.pb.h"
+#include "proto/tripdirections.pb.h"
+#include "proto/directions_options.pb.h"
+#include "odin/directions_batch.h"
+
+#include "test.h"
+
+using namespace valhalla::odin;
+
+namespace {
+
+// A straight drive along a named street of the specified edge count
+std::string MakeTripPath(int edge_count, const std::string& name) {
+  TripPath path;
+  for (int i = 0; i <= edge_count; ++i) {
+    auto* node = path.add_node();
+    if (i < edge_count) {
+      auto* edge = node->mutable_edge();
+      edge->add_name(name);
+      edge->set_length(0.5f);
+      edge->set_begin_heading(90);
+      edge->set_end_heading(90);
+      edge->set_travel_mode(TripPath_TravelMode_kDrive);
+      edge->set_begin_shape_index(i);
+      edge->set_end_shape_index(i + 1);
+    }
+  }
+  for (int i = 0; i < 2; ++i) {
+    auto* location = path.add_location();
+    location->mutable_ll()->set_lat(38.5f);
+    location->mutable_ll()->set_lng(-120.2f);
+  }
+  auto* admin = path.add_admin();
+  admin->set_country_code("US");
+  admin->set_state_code("PA");
+  path.set_shape("_p~iF~ps|U_ulLnnqC_mqNvxq`@");
+  return path.SerializeAsString();
+}
+
+DirectionsOptions MakeOptions(const std::string& language) {
+  DirectionsOptions options;
+  options.set_language(language);
+  return options;
+}
+
+std::vector<std::string> BuildAll(uint32_t thread_count,
+                                  const std::vector<std::string>& paths) {
+  DirectionsBatch batch(thread_count);
+  std::vector<size_t> legs;
+  for (size_t i = 0; i < paths.size(); ++i) {
+    // Alternate the languages so the legs are regrouped
+    auto options_index = batch.AddOptions(MakeOptions(i % 2 ? "de-DE" : "en-US"));
+    legs.push_back(batch.Add(options_index, paths[i].data(), paths[i].size()));
+  }
+  if (batch.options_count() != std::min<size_t>(paths.size(), 2))
+    throw std::runtime_error("Identical options should be kept once");
+
+  batch.Build(true);
+  std::vector<std::string> directions;
+  for (auto leg : legs) {
+    const auto& result = batch.GetResult(leg);
+    directions.push_back(result.error_code ?
+        "error " + std::to_string(result.error_code) : result.directions);
+  }
+  return directions;
+}
+
+void TestBuild() {
+  std::vector<std::string> paths;
+  for (int i = 1; i <= 8; ++i) {
+    paths.push_back(MakeTripPath(i, "Street " + std::to_string(i)));
+  }
+
+  // The results are in the order of the legs whatever the thread count
+  auto directions = BuildAll(1, paths);
+  if (BuildAll(4, paths) != directions)
+    throw std::runtime_error("Threads should not change the directions");
+
+  for (size_t i = 0; i < directions.size(); ++i) {
+    TripDirections trip_directions;
+    if (!trip_directions.ParseFromString(directions[i])
+        || (trip_directions.maneuver_size() != 2))
+      throw std::runtime_error("Incorrect directions of leg "
+          + std::to_string(i));
+  }
+}
+
+void TestErrors() {
+  std::vector<std::string> paths = { MakeTripPath(2, "Main Street"),
+      "not a trip path", MakeTripPath(3, "Main Street") };
+
+  // A failed leg does not affect the others
+  for (uint32_t thread_count : { 1, 2 }) {
+    auto directions = BuildAll(thread_count, paths);
+    if (directions[1] != "error 202")
+      throw std::runtime_error("Invalid leg should fail: " + directions[1]);
+    if ((directions[0].compare(0, 5, "error") == 0)
+        || (directions[2].compare(0, 5, "error") == 0))
+      throw std::runtime_error("Valid legs should be built");
+  }
+}
+
+void TestLanguages() {
+  auto path = MakeTripPath(3, "Main Street");
+  DirectionsBatch batch;
+  auto options = MakeOptions("en-US");
+  options.add_languages("de-DE");
+  options.add_languages("fr-FR");
+  auto leg = batch.Add(batch.AddOptions(options), path.data(), path.size());
+  batch.Add(batch.AddOptions(MakeOptions("de-DE")), path.data(), path.size());
+  batch.Add(batch.AddOptions(MakeOptions("fr-FR")), path.data(), path.size());
+  batch.Build();
+
+  // The directions of each language are those of a leg in that language alone
+  const auto& result = batch.GetResult(leg);
+  if (result.error_code || (result.translations.size() != 2))
+    throw std::runtime_error("Expected the directions of 2 more languages");
+  if (result.translations[0] != batch.GetResult(1).directions
+      || result.translations[1] != batch.GetResult(2).directions)
+    throw std::runtime_error("Each language should match its own build");
+  if (result.directions != BuildAll(1, { path })[0])
+    throw std::runtime_error("The first language should match its own build");
+  if (result.directions == result.translations[0])
+    throw std::runtime_error("The languages should differ");
+}
+
+}
+
+int main() {
+  test::suite suite("directions_batch");
+
+  suite.test(TEST_CASE(TestBuild));
+  suite.test(TEST_CASE(TestErrors));
+  suite.test(TEST_CASE(TestLanguages));
+
+  return suite.tear_down();
+}
@@ -0,0 +1,137 @@
+#include <string>
+
+#include "odin/directions_cache.h"
+
+#include "test.h"
+
+using namespace valhalla::odin;
+
+namespace {
+
+std::string Key(const std::string& trip_path,
+                const std::string& options = "options") {
+  return DirectionsCache::MakeKey(trip_path.data(), trip_path.size(), options);
+}
+
+void Insert(DirectionsCache& cache, const std::string& trip_path,
+            const std::string& directions,
+            const std::string& options = "options") {
+  cache.Insert(Key(trip_path, options), trip_path.data(), trip_path.size(),
+               directions);
+}
+
+void TryFindKey(DirectionsCache& cache, const std::string& key,
+                const std::string& trip_path, const std::string& expected) {
+  const std::string* directions = cache.Find(key, trip_path.data(),
+                                             trip_path.size());
+  if (expected.empty()) {
+    if (directions)
+      throw std::runtime_error("Directions should not be cached: "
+          + *directions);
+  } else if (!directions || (*directions != expected)) {
+    throw std::runtime_error("Incorrect cached directions - expected: "
+        + expected + "  |  produced: " + (directions ? *directions : "none"));
+  }
+}
+
+void TestKey() {
+  if (Key("trip path") != Key("trip path"))
+    throw std::runtime_error("Same path and options should have the same key");
+  if (Key("trip path") == Key("trip_path"))
+    throw std::runtime_error("Different paths should have different keys");
+  if (Key("trip path", "km") == Key("trip path", "mi"))
+    throw std::runtime_error("Different options should have different keys");
+  if (Key("trip path 1234567") == Key("trip path 123456"))
+    throw std::runtime_error("Different sizes should have different keys");
+}
+
+void TryFind(DirectionsCache& cache, const std::string& trip_path,
+             const std::string& expected,
+             const std::string& options = "options") {
+  TryFindKey(cache, Key(trip_path, options), trip_path, expected);
+}
+
+void TestFind() {
+  DirectionsCache cache(4096);
+  TryFind(cache, "a", "");
+  Insert(cache, "a", "directions a");
+  Insert(cache, "b", "directions b");
+  TryFind(cache, "a", "directions a");
+  TryFind(cache, "b", "directions b");
+  TryFind(cache, "a", "", "other options");
+
+  // Replacing keeps a single entry
+  Insert(cache, "a", "new directions a");
+  TryFind(cache, "a", "new directions a");
+
+  if (cache.size() != 2)
+    throw std::runtime_error("Incorrect size: " + std::to_string(cache.size()));
+  if (cache.hits() != 3 || cache.misses() != 2 || cache.evictions() != 0)
+    throw std::runtime_error("Incorrect counters");
+}
+
+void TestEviction() {
+  // Room for 3 entries
+  std::string directions(500, 'd');
+  DirectionsCache cache(3 * (Key("a").size() + 1 + directions.size() + 128));
+  Insert(cache, "a", directions);
+  Insert(cache, "b", directions);
+  Insert(cache, "c", directions);
+
+  // Make b the least recently used
+  TryFind(cache, "a", directions);
+  Insert(cache, "d", directions);
+  TryFind(cache, "b", "");
+  TryFind(cache, "c", directions);
+  TryFind(cache, "d", directions);
+
+  if (cache.evictions() != 1)
+    throw std::runtime_error("Incorrect evictions: "
+        + std::to_string(cache.evictions()));
+  if (cache.bytes() > cache.max_bytes())
+    throw std::runtime_error("Cache is over its memory budget");
+
+  // Directions larger than the budget are not cached
+  Insert(cache, "e", std::string(cache.max_bytes(), 'e'));
+  TryFind(cache, "e", "");
+  TryFind(cache, "d", directions);
+}
+
+void TestCollision() {
+  // Another trip path with the same key is not a hit
+  DirectionsCache cache(4096);
+  std::string key = Key("trip path a");
+  cache.Insert(key, "trip path a", 11, "directions a");
+  TryFindKey(cache, key, "trip path b", "");
+  TryFindKey(cache, key, "trip path", "");
+  TryFindKey(cache, key, "trip path a", "directions a");
+
+  // and it replaces the directions
+  cache.Insert(key, "trip path b", 11, "directions b");
+  TryFindKey(cache, key, "trip path a", "");
+  TryFindKey(cache, key, "trip path b", "directions b");
+  if (cache.size() != 1)
+    throw std::runtime_error("Incorrect size: " + std::to_string(cache.size()));
+}
+
+void TestDisabled() {
+  DirectionsCache cache(0);
+  Insert(cache, "a", "directions a");
+  TryFind(cache, "a", "");
+  if (cache.enabled() || cache.size() != 0 || cache.misses() != 0)
+    throw std::runtime_error("Disabled cache should not cache or count");
+}
+
+}
+
+int main() {
+  test::suite suite("directions_cache");
+
+  suite.test(TEST_CASE(TestKey));
+  suite.test(TEST_CASE(TestFind));
+  suite.test(TEST_CASE(TestEviction));
+  suite.test(TEST_CASE(TestCollision));
+  suite.test(TEST_CASE(TestDisabled));
+
+  return suite.tear_down();
+}
@@ -0,0 +1,125 @@
+#include <string>
+
+#include "proto/trippath.pb.h"
+#include "proto/tripdirections.pb.h"
+#include "proto/directions_options.pb.h"
+#include "odin/directionsbuilder.h"
+#include "odin/duplicate_legs.h"
+
+#include "test.h"
+
+using namespace valhalla::odin;
+
+namespace {
+
+std::string TripPathBytes(uint32_t leg_id, const std::string& name,
+                          bool has_leg_id = true) {
+  TripPath path;
+  path.set_trip_id(7);
+  if (has_leg_id)
+    path.set_leg_id(leg_id);
+  path.set_leg_count(3);
+  path.add_admin()->set_country_code("US");
+  path.add_location()->mutable_ll()->set_lat(40.0f);
+  path.add_location()->mutable_ll()->set_lat(40.001f);
+  auto* edge = path.add_node()->mutable_edge();
+  edge->add_name(name);
+  edge->set_length(0.1f);
+  edge->set_travel_mode(TripPath_TravelMode_kDrive);
+  edge->set_end_shape_index(1);
+  path.add_node()->set_admin_index(0);
+  path.set_shape("shape");
+  return path.SerializeAsString();
+}
+
+std::string DirectionsBytes(uint32_t leg_id) {
+  TripDirections directions;
+  directions.set_trip_id(7);
+  directions.set_leg_id(leg_id);
+  directions.set_leg_count(3);
+  directions.add_maneuver()->add_street_name("Main Street");
+  directions.set_shape("shape");
+  return directions.SerializeAsString();
+}
+
+void TestFind() {
+  auto first = TripPathBytes(0, "Main Street");
+  auto other = TripPathBytes(1, "Elm Street");
+  auto repeat = TripPathBytes(300, "Main Street");
+  auto same = TripPathBytes(0, "Main Street");
+
+  DuplicateLegs legs;
+  if (legs.Add(first.data(), first.size()) != 0)
+    throw std::runtime_error("The first leg is not a duplicate");
+  if (legs.Add(other.data(), other.size()) != 1)
+    throw std::runtime_error("A different leg is not a duplicate");
+  if (legs.Add(repeat.data(), repeat.size()) != 0)
+    throw std::runtime_error("A leg only differing in its leg id is a duplicate");
+  if (legs.Add(same.data(), same.size()) != 0)
+    throw std::runtime_error("An identical leg is a duplicate");
+  if (legs.size() != 4)
+    throw std::runtime_error("Expected 4 legs");
+
+  legs.clear();
+  if (legs.Add(repeat.data(), repeat.size()) != 0 || legs.size() != 1)
+    throw std::runtime_error("Clear should forget the legs");
+}
+
+void TestSetLegId() {
+  auto first = TripPathBytes(0, "Main Street");
+  auto repeat = TripPathBytes(300, "Main Street");
+  DuplicateLegs legs;
+  legs.Add(first.data(), first.size());
+  legs.Add(repeat.data(), repeat.size());
+
+  // Patched directions are the directions built for the leg
+  auto directions = DirectionsBytes(0);
+  legs.SetLegId(1, directions);
+  if (directions != DirectionsBytes(300))
+    throw std::runtime_error("The leg id should be patched");
+  TripDirections parsed;
+  if (!parsed.ParseFromString(directions) || parsed.leg_id() != 300
+      || parsed.maneuver(0).street_name(0) != "Main Street")
+    throw std::runtime_error("The patched directions should parse");
+}
+
+std::string BuildDirections(const std::string& trip_path_bytes) {
+  TripPath trip_path;
+  trip_path.ParseFromString(trip_path_bytes);
+  DirectionsOptions directions_options;
+  return DirectionsBuilder().Build(directions_options, trip_path)
+      .SerializeAsString();
+}
+
+void TestMissingLegId() {
+  auto first = TripPathBytes(2, "Main Street");
+  auto repeat = TripPathBytes(0, "Main Street", false);
+  DuplicateLegs legs;
+  legs.Add(first.data(), first.size());
+  if (legs.Add(repeat.data(), repeat.size()) != 0)
+    throw std::runtime_error("A leg without a leg id can repeat one with");
+
+  // The patched directions are those built directly for each leg, which
+  // have a leg id of 0 when the trip path has none
+  auto first_directions = BuildDirections(first);
+  auto repeat_directions = BuildDirections(repeat);
+  auto directions = first_directions;
+  legs.SetLegId(1, directions);
+  if (directions != repeat_directions)
+    throw std::runtime_error("The leg id should be set to 0");
+  legs.SetLegId(0, directions);
+  if (directions != first_directions)
+    throw std::runtime_error("The leg id should be set back");
+}
+
+}
+
+int main() {
+  test::suite suite("duplicate_legs");
+
+  suite.test(TEST_CASE(TestFind));
+  suite.test(TEST_CASE(TestSetLegId));
+  suite.test(TEST_CASE(TestMissingLegId));
+
+  return suite.tear_down();
+}
@@ -0,0 +1,58 @@
+#include "proto/trippath.pb.h"
+#include "proto/tripdirections.pb.h"
+#include "odin/enum_table.h"
+
+#include "test.h"
+
+using namespace valhalla::odin;
+
+namespace {
+
+constexpr EnumTable<TripPath_TravelMode, TripDirections_TravelMode, 4> kTravelModes {{
+  { TripPath_TravelMode_kDrive, TripDirections_TravelMode_kDrive },
+  { TripPath_TravelMode_kPedestrian, TripDirections_TravelMode_kPedestrian },
+  { TripPath_TravelMode_kBicycle, TripDirections_TravelMode_kBicycle },
+  { TripPath_TravelMode_kTransit, TripDirections_TravelMode_kTransit },
+}};
+static_assert(kTravelModes.IsDense(), "The travel modes are in order");
+
+// Out of order and missing values are caught at compile time
+constexpr EnumTable<TripPath_TravelMode, TripDirections_TravelMode, 2> kUnordered {{
+  { TripPath_TravelMode_kPedestrian, TripDirections_TravelMode_kPedestrian },
+  { TripPath_TravelMode_kDrive, TripDirections_TravelMode_kDrive },
+}};
+static_assert(!kUnordered.IsDense(), "Unordered values are not dense");
+
+constexpr EnumTable<TripPath_TravelMode, TripDirections_TravelMode, 3> kMissing {{
+  { TripPath_TravelMode_kDrive, TripDirections_TravelMode_kDrive },
+  { TripPath_TravelMode_kPedestrian, TripDirections_TravelMode_kPedestrian },
+}};
+static_assert(!kMissing.IsDense(), "Missing values are not dense");
+
+void TestTranslate() {
+  if (kTravelModes[TripPath_TravelMode_kBicycle] != TripDirections_TravelMode_kBicycle
+      || kTravelModes[TripPath_TravelMode_kTransit] != TripDirections_TravelMode_kTransit)
+    throw std::runtime_error("Travel modes should be translated");
+}
+
+void TestUnknown() {
+  try {
+    kTravelModes[static_cast<TripPath_TravelMode>(4)];
+  } catch (const valhalla::valhalla_exception_t& e) {
+    if (e.error_code != 202)
+      throw std::runtime_error("Expected error code 202");
+    return;
+  }
+  throw std::runtime_error("An unknown value should throw");
+}
+
+}
+
+int main() {
+  test::suite suite("enum_table");
+
+  suite.test(TEST_CASE(TestTranslate));
+  suite.test(TEST_CASE(TestUnknown));
+
+  return suite.tear_down();
+}
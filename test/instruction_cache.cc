@@ -0,0 +1,149 @@
+#include <string>
+#include <initializer_list>
+
+#include "odin/instruction_cache.h"
+
+#include "test.h"
+
+using namespace valhalla::odin;
+
+namespace {
+
+// Tagged phrases outlive the cache as those of the locales do
+const std::string kTurnPhrase = "Turn left onto <STREET_NAMES>.";
+const std::string kBearPhrase = "Bear left onto <STREET_NAMES>.";
+constexpr const char* kStreetNamesTag = "<STREET_NAMES>";
+
+void TryFind(InstructionCache& cache, const InstructionCache::Key& key,
+             std::initializer_list<InstructionCache::PhraseTag> phrase_tags,
+             const std::string& expected) {
+  std::string instruction;
+  bool found = cache.Find(key, phrase_tags, instruction);
+  if (expected.empty()) {
+    if (found)
+      throw std::runtime_error("Instruction should not be cached: "
+          + instruction);
+  } else if (!found || (instruction != expected)) {
+    throw std::runtime_error("Incorrect cached instruction - expected: "
+        + expected + "  |  produced: " + (found ? instruction : "none"));
+  }
+}
+
+void TryFind(InstructionCache& cache, const std::string& phrase,
+             const std::string& value, const std::string& expected) {
+  auto key = InstructionCache::GetKey(phrase, { { kStreetNamesTag, value } });
+  TryFind(cache, key, { { kStreetNamesTag, value } }, expected);
+}
+
+void Insert(InstructionCache& cache, const std::string& phrase,
+            const std::string& value, const std::string& instruction) {
+  auto key = InstructionCache::GetKey(phrase, { { kStreetNamesTag, value } });
+  cache.Insert(key, { { kStreetNamesTag, value } }, instruction);
+}
+
+void TestFind() {
+  InstructionCache cache(64);
+  TryFind(cache, kTurnPhrase, "Main Street", "");
+  Insert(cache, kTurnPhrase, "Main Street", "Turn left onto Main Street.");
+  Insert(cache, kTurnPhrase, "Elm Street", "Turn left onto Elm Street.");
+  TryFind(cache, kTurnPhrase, "Main Street", "Turn left onto Main Street.");
+  TryFind(cache, kTurnPhrase, "Elm Street", "Turn left onto Elm Street.");
+  TryFind(cache, kTurnPhrase, "Oak Street", "");
+
+  if (cache.size() != 2)
+    throw std::runtime_error("Incorrect size: " + std::to_string(cache.size()));
+  if (cache.hits() != 2 || cache.misses() != 2 || cache.evictions() != 0)
+    throw std::runtime_error("Incorrect counters");
+}
+
+void TestKey() {
+  // Another phrase with the same values, or the same characters split
+  // between the values differently, is another instruction
+  InstructionCache cache(64);
+  const std::string ab = "ab", c = "c", a = "a", bc = "bc";
+  auto ab_c = InstructionCache::GetKey(kTurnPhrase,
+                                       { { "<A>", ab }, { "<B>", c } });
+  auto a_bc = InstructionCache::GetKey(kTurnPhrase,
+                                       { { "<A>", a }, { "<B>", bc } });
+  if (ab_c == a_bc)
+    throw std::runtime_error("Values split differently should have other keys");
+  Insert(cache, kTurnPhrase, "Main Street", "Turn left onto Main Street.");
+  cache.Insert(ab_c, { { "<A>", ab }, { "<B>", c } }, "ab c");
+  TryFind(cache, kBearPhrase, "Main Street", "");
+  TryFind(cache, a_bc, { { "<A>", a }, { "<B>", bc } }, "");
+  TryFind(cache, ab_c, { { "<A>", ab }, { "<B>", c } }, "ab c");
+  TryFind(cache, InstructionCache::GetKey(kTurnPhrase, {}), {}, "");
+
+  // Keyed by the address of the phrase rather than its text
+  std::string copy = kTurnPhrase;
+  TryFind(cache, copy, "Main Street", "");
+}
+
+void TestCollision() {
+  // Tag values with the same key are compared rather than trusted
+  InstructionCache cache(64);
+  const std::string main = "Main Street", elm = "Elm Street";
+  auto key = InstructionCache::GetKey(kTurnPhrase,
+                                      { { kStreetNamesTag, main } });
+  cache.Insert(key, { { kStreetNamesTag, main } },
+               "Turn left onto Main Street.");
+  TryFind(cache, key, { { kStreetNamesTag, elm } }, "");
+  TryFind(cache, key, { { kStreetNamesTag, main }, { kStreetNamesTag, main } },
+          "");
+  TryFind(cache, key, { { kStreetNamesTag, main } },
+          "Turn left onto Main Street.");
+
+  // The colliding values replace the cached instruction
+  cache.Insert(key, { { kStreetNamesTag, elm } }, "Turn left onto Elm Street.");
+  TryFind(cache, key, { { kStreetNamesTag, main } }, "");
+  TryFind(cache, key, { { kStreetNamesTag, elm } },
+          "Turn left onto Elm Street.");
+  if (cache.size() != 1)
+    throw std::runtime_error("Incorrect size: " + std::to_string(cache.size()));
+}
+
+void TestBounded() {
+  InstructionCache cache(32);
+  for (size_t i = 0; i < 1000; ++i) {
+    Insert(cache, kTurnPhrase, std::to_string(i),
+           "instruction " + std::to_string(i));
+    if (cache.size() > cache.max_entries())
+      throw std::runtime_error("Cache is over its maximum entries: "
+          + std::to_string(cache.size()));
+  }
+  if (cache.evictions() == 0)
+    throw std::runtime_error("Full shards should have been emptied");
+
+  // The last insert is always cached
+  TryFind(cache, kTurnPhrase, "999", "instruction 999");
+}
+
+void TestDisabled() {
+  InstructionCache cache;
+  Insert(cache, kTurnPhrase, "Main Street", "instruction");
+  TryFind(cache, kTurnPhrase, "Main Street", "");
+  if (cache.enabled() || cache.size() != 0 || cache.misses() != 0)
+    throw std::runtime_error("Cache should be disabled by default");
+
+  cache.set_max_entries(16);
+  Insert(cache, kTurnPhrase, "Main Street", "instruction");
+  TryFind(cache, kTurnPhrase, "Main Street", "instruction");
+
+  // Resizing empties the cache
+  cache.set_max_entries(32);
+  TryFind(cache, kTurnPhrase, "Main Street", "");
+}
+
+}
+
+int main() {
+  test::suite suite("instruction_cache");
+
+  suite.test(TEST_CASE(TestFind));
+  suite.test(TEST_CASE(TestKey));
+  suite.test(TEST_CASE(TestCollision));
+  suite.test(TEST_CASE(TestBounded));
+  suite.test(TEST_CASE(TestDisabled));
+
+  return suite.tear_down();
+}
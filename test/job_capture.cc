@@ -0,0 +1,120 @@
+#include <cstdio>
+#include <string>
+#include <list>
+#include <fstream>
+
+#include <unistd.h>
+
+#include "odin/job_capture.h"
+
+#include "test.h"
+
+using namespace valhalla::odin;
+
+namespace {
+
+bool Exists(const std::string& file_name) {
+  return access(file_name.c_str(), F_OK) == 0;
+}
+
+void TestRoundTrip() {
+  std::string file_name;
+  {
+    JobCapture capture("/tmp", 1 << 20, 0);
+    file_name = capture.file_name();
+    capture.Write(std::list<std::string>{ "{\"id\":1}", "leg one", "" });
+    capture.Write(std::list<std::string>{ "{\"id\":2}", "leg two" });
+
+    // Frame by frame
+    std::string leg = "leg three";
+    capture.BeginJob(2);
+    capture.WriteFrame("{}", 2);
+    capture.WriteFrame(leg.data(), leg.size());
+    capture.EndJob();
+  }
+
+  auto jobs = JobCapture::Read(file_name);
+  std::remove(file_name.c_str());
+  if (jobs.size() != 3)
+    throw std::runtime_error("Expected 3 jobs");
+  if (jobs[0].frames.size() != 3 || jobs[0].frames[1] != "leg one"
+      || !jobs[0].frames[2].empty())
+    throw std::runtime_error("The first job was not read back");
+  if (jobs[1].frames.size() != 2 || jobs[1].frames[0] != "{\"id\":2}")
+    throw std::runtime_error("The second job was not read back");
+  if (jobs[2].frames.size() != 2 || jobs[2].frames[1] != "leg three")
+    throw std::runtime_error("The third job was not read back");
+  if (jobs[1].timestamp < jobs[0].timestamp)
+    throw std::runtime_error("Jobs should be in capture order");
+}
+
+void TestRoll() {
+  // Every job fills a file so each one starts the next
+  std::list<std::string> names;
+  {
+    JobCapture capture("/tmp", 16, 2);
+    for (int i = 0; i < 4; ++i) {
+      capture.Write(std::list<std::string>{ "job " + std::to_string(i) });
+      names.push_back(capture.file_name());
+    }
+  }
+
+  auto name = names.begin();
+  if (Exists(*name++) || Exists(*name++))
+    throw std::runtime_error("The oldest captures should be removed");
+  auto jobs = JobCapture::Read(*name);
+  if (jobs.size() != 1 || jobs[0].frames[0] != "job 2")
+    throw std::runtime_error("Expected the third job");
+  for (; name != names.end(); ++name)
+    std::remove(name->c_str());
+}
+
+void TestTruncated() {
+  std::string file_name;
+  {
+    JobCapture capture("/tmp", 1 << 20, 0);
+    file_name = capture.file_name();
+    capture.Write(std::list<std::string>{ "complete" });
+    capture.Write(std::list<std::string>{ "cut short" });
+  }
+
+  // Drop the last bytes as a crash would
+  std::ifstream in(file_name, std::ios::binary);
+  std::string bytes((std::istreambuf_iterator<char>(in)),
+                    std::istreambuf_iterator<char>());
+  in.close();
+  std::ofstream(file_name, std::ios::binary | std::ios::trunc)
+      .write(bytes.data(), bytes.size() - 3);
+
+  auto jobs = JobCapture::Read(file_name);
+  std::remove(file_name.c_str());
+  if (jobs.size() != 1 || jobs[0].frames[0] != "complete")
+    throw std::runtime_error("Only the complete job should be read");
+}
+
+void TestBadMagic() {
+  std::string file_name = "/tmp/odin_capture_test_" + std::to_string(getpid());
+  std::ofstream(file_name) << "not a capture";
+  bool thrown = false;
+  try {
+    JobCapture::Read(file_name);
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  std::remove(file_name.c_str());
+  if (!thrown)
+    throw std::runtime_error("Reading a file that is not a capture should throw");
+}
+
+}
+
+int main() {
+  test::suite suite("job_capture");
+
+  suite.test(TEST_CASE(TestRoundTrip));
+  suite.test(TEST_CASE(TestRoll));
+  suite.test(TEST_CASE(TestTruncated));
+  suite.test(TEST_CASE(TestBadMagic));
+
+  return suite.tear_down();
+}
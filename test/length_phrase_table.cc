@@ -0,0 +1,201 @@
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/string/replace.hpp>
+
+#include "odin/length_phrase_table.h"
+#include "odin/narrative_dictionary.h"
+#include "odin/util.h"
+
+#include "test.h"
+
+using namespace valhalla::odin;
+
+namespace {
+
+// The metric length phrase as it was rendered before the phrases were
+// precomputed, the table must produce the same phrase for every length
+std::string ExpectedMetricLength(
+    float kilometers, const std::vector<std::string>& metric_lengths,
+    const NumberFormatter& number_formatter) {
+  std::string length_string;
+  std::string distance;
+  int tenths = std::round(kilometers * 10);
+
+  if (tenths > 10) {
+    length_string += metric_lengths.at(kKilometersIndex);
+    distance = number_formatter.Format(kilometers, (tenths % 10 > 0));
+  } else if (tenths == 10) {
+    length_string += metric_lengths.at(kOneKilometerIndex);
+  } else if (tenths == 5) {
+    length_string += metric_lengths.at(kHalfKilometerIndex);
+  } else {
+    int meters = std::round(kilometers * 1000);
+    if (meters > 94) {
+      length_string += metric_lengths.at(kMetersIndex);
+      distance = number_formatter.Format(((meters + 50) / 100) * 100);
+    } else if (meters > 9) {
+      length_string += metric_lengths.at(kMetersIndex);
+      distance = number_formatter.Format(((meters + 5) / 10) * 10);
+    } else {
+      length_string += metric_lengths.at(kSmallMetersIndex);
+    }
+  }
+
+  boost::replace_all(length_string, kKilometersTag, distance);
+  boost::replace_all(length_string, kMetersTag, distance);
+  return length_string;
+}
+
+// The US customary length phrase as it was rendered before the phrases were
+// precomputed
+std::string ExpectedUsCustomaryLength(
+    float miles, const std::vector<std::string>& us_customary_lengths,
+    const NumberFormatter& number_formatter) {
+  std::string length_string;
+  std::string distance;
+  int tenths = std::round(miles * 10);
+
+  if (tenths > 10) {
+    length_string += us_customary_lengths.at(kMilesIndex);
+    distance = number_formatter.Format(miles, (tenths % 10 > 0));
+  } else if (tenths == 10) {
+    length_string += us_customary_lengths.at(kOneMileIndex);
+  } else if (tenths == 5) {
+    length_string += us_customary_lengths.at(kHalfMileIndex);
+  } else if (tenths > 1) {
+    length_string += us_customary_lengths.at(kTenthsOfMileIndex);
+    distance = number_formatter.Format(tenths);
+  } else if (miles > 0.0973f && tenths == 1) {
+    length_string += us_customary_lengths.at(kOneTenthOfMileIndex);
+  } else {
+    int feet = std::round(miles * 5280);
+    if (feet > 94) {
+      length_string += us_customary_lengths.at(kFeetIndex);
+      distance = number_formatter.Format(((feet + 50) / 100) * 100);
+    } else if (feet > 9) {
+      length_string += us_customary_lengths.at(kFeetIndex);
+      distance = number_formatter.Format(((feet + 5) / 10) * 10);
+    } else {
+      length_string += us_customary_lengths.at(kSmallFeetIndex);
+    }
+  }
+
+  boost::replace_all(length_string, kMilesTag, distance);
+  boost::replace_all(length_string, kTenthsOfMilesTag, distance);
+  boost::replace_all(length_string, kFeetTag, distance);
+  return length_string;
+}
+
+void TryLength(const std::string& language_tag,
+               const LengthPhraseTable& table,
+               const std::vector<std::string>& metric_lengths,
+               const std::vector<std::string>& us_customary_lengths,
+               const NumberFormatter& number_formatter, float length) {
+  std::string metric = table.GetMetricLength(length);
+  std::string expected_metric = ExpectedMetricLength(length, metric_lengths,
+                                                     number_formatter);
+  if (metric != expected_metric) {
+    throw std::runtime_error(language_tag + " incorrect metric length for "
+        + std::to_string(length) + " - expected: " + expected_metric
+        + "  |  produced: " + metric);
+  }
+
+  std::string us_customary = table.GetUsCustomaryLength(length);
+  std::string expected_us_customary = ExpectedUsCustomaryLength(
+      length, us_customary_lengths, number_formatter);
+  if (us_customary != expected_us_customary) {
+    throw std::runtime_error(language_tag
+        + " incorrect US customary length for " + std::to_string(length)
+        + " - expected: " + expected_us_customary + "  |  produced: "
+        + us_customary);
+  }
+}
+
+void TryLengths(const std::string& language_tag,
+                const std::vector<std::string>& metric_lengths,
+                const std::vector<std::string>& us_customary_lengths,
+                const NumberFormatter& number_formatter) {
+  LengthPhraseTable table(metric_lengths, us_customary_lengths,
+                          number_formatter);
+
+  // Every thousandth up to past the end of the table
+  for (int thousandths = 0; thousandths < 110000; ++thousandths) {
+    TryLength(language_tag, table, metric_lengths, us_customary_lengths,
+              number_formatter, thousandths / 1000.0f);
+  }
+
+  // Every ten thousandth of the meters and feet buckets
+  for (int ten_thousandths = 0; ten_thousandths < 20000; ++ten_thousandths) {
+    TryLength(language_tag, table, metric_lengths, us_customary_lengths,
+              number_formatter, ten_thousandths / 10000.0f);
+  }
+
+  // The lengths closest to each half way point between two tenths
+  for (int halves = 1; halves < 2200; halves += 2) {
+    float length = halves / 20.0f;
+    float below = length;
+    float above = length;
+    for (int i = 0; i < 4; ++i) {
+      TryLength(language_tag, table, metric_lengths, us_customary_lengths,
+                number_formatter, below);
+      TryLength(language_tag, table, metric_lengths, us_customary_lengths,
+                number_formatter, above);
+      below = std::nextafter(below, 0.0f);
+      above = std::nextafter(above, 1000.0f);
+    }
+  }
+}
+
+void TestLengths() {
+  for (const auto& locale : get_locales()) {
+    const NarrativeDictionary& dictionary = *locale.second;
+    TryLengths(locale.first, dictionary.start_verbal_subset.metric_lengths,
+               dictionary.start_verbal_subset.us_customary_lengths,
+               dictionary.GetNumberFormatter());
+    TryLengths(locale.first, dictionary.continue_verbal_subset.metric_lengths,
+               dictionary.continue_verbal_subset.us_customary_lengths,
+               dictionary.GetNumberFormatter());
+    TryLengths(locale.first,
+               dictionary.post_transition_verbal_subset.metric_lengths,
+               dictionary.post_transition_verbal_subset.us_customary_lengths,
+               dictionary.GetNumberFormatter());
+  }
+}
+
+void TestDictionaryLengths() {
+  const NarrativeDictionary& dictionary = *get_locales().at("en-US");
+  const LengthPhraseTable& length_phrases =
+      dictionary.continue_verbal_subset.length_phrases;
+
+  if (length_phrases.GetMetricLength(1.0f) != "1 kilometer")
+    throw std::runtime_error("Incorrect metric length: "
+        + length_phrases.GetMetricLength(1.0f));
+  if (length_phrases.GetMetricLength(0.004f) != "less than 10 meters")
+    throw std::runtime_error("Incorrect metric length: "
+        + length_phrases.GetMetricLength(0.004f));
+  if (length_phrases.GetMetricLength(0.4496f) != "500 meters")
+    throw std::runtime_error("Incorrect metric length: "
+        + length_phrases.GetMetricLength(0.4496f));
+  if (length_phrases.GetMetricLength(0.9497f) != "1000 meters")
+    throw std::runtime_error("Incorrect metric length: "
+        + length_phrases.GetMetricLength(0.9497f));
+  if (length_phrases.GetUsCustomaryLength(0.5f) != "a half mile")
+    throw std::runtime_error("Incorrect US customary length: "
+        + length_phrases.GetUsCustomaryLength(0.5f));
+  if (length_phrases.GetUsCustomaryLength(250.0f) != "250 miles")
+    throw std::runtime_error("Incorrect US customary length: "
+        + length_phrases.GetUsCustomaryLength(250.0f));
+}
+
+}
+
+int main() {
+  test::suite suite("length_phrase_table");
+
+  suite.test(TEST_CASE(TestLengths));
+  suite.test(TEST_CASE(TestDictionaryLengths));
+
+  return suite.tear_down();
+}
@@ -0,0 +1,135 @@
+#include <string>
+#include <vector>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include "odin/logger.h"
+
+#include "test.h"
+
+using namespace valhalla::odin;
+
+namespace {
+
+std::vector<std::string> lines;
+
+void Capture(Logger::Level level, Logger::Category category,
+             const std::string& line) {
+  lines.push_back(line);
+}
+
+int evaluations = 0;
+
+int Evaluate() {
+  ++evaluations;
+  return 42;
+}
+
+void TestLevel() {
+  lines.clear();
+  Logger::SetSink(Capture);
+  Logger::SetLevel(Logger::kInfo);
+
+  // Filtered lines do not evaluate their fields
+  evaluations = 0;
+  ODIN_LOG(kDebug, kRequest).Field("value", Evaluate());
+  if (evaluations != 0 || !lines.empty())
+    throw std::runtime_error("Filtered line should not be formatted");
+
+  ODIN_LOG(kInfo, kRequest).Field("id", 7).Field("name", "odin")
+      .Field("offset", -12).Field("rate", 0.5);
+  if (evaluations != 0 || lines.size() != 1
+      || lines[0] != "request id=7 name=odin offset=-12 rate=0.500")
+    throw std::runtime_error("Incorrect line: "
+        + (lines.empty() ? std::string() : lines[0]));
+
+  Logger::SetLevel(Logger::kOff);
+  ODIN_LOG(kError, kRequest).Field("value", Evaluate());
+  if (evaluations != 0 || lines.size() != 1)
+    throw std::runtime_error("Logging should be off");
+
+  Logger::SetLevel(Logger::kInfo);
+  Logger::SetSink(nullptr);
+}
+
+void TestSampling() {
+  lines.clear();
+  Logger::SetSink(Capture);
+  Logger::SetSampleRate(Logger::kCache, 10);
+
+  for (int i = 0; i < 100; ++i) {
+    ODIN_LOG(kInfo, kCache).Field("i", i);
+    ODIN_LOG(kInfo, kStats).Field("i", i);
+  }
+
+  // Only the cache lines are sampled
+  size_t cache_lines = 0;
+  for (const auto& line : lines) {
+    cache_lines += (line.compare(0, 5, "cache") == 0);
+  }
+  if (cache_lines != 10 || lines.size() != 110)
+    throw std::runtime_error("Incorrect sampling: "
+        + std::to_string(cache_lines));
+
+  Logger::SetSampleRate(Logger::kCache, 1);
+  Logger::SetSink(nullptr);
+}
+
+void TestAsync() {
+  lines.clear();
+  Logger::SetSink(Capture);
+  Logger::SetAsync(true, 1024);
+
+  for (uint64_t i = 0; i < 1000; ++i) {
+    ODIN_LOG(kInfo, kRequest).Field("id", i);
+  }
+  Logger::Flush();
+
+  // Every line is written in order unless the queue was full
+  if (lines.size() + Logger::dropped() != 1000)
+    throw std::runtime_error("Lines were lost: "
+        + std::to_string(lines.size()));
+  for (size_t i = 1; i < lines.size(); ++i) {
+    if (std::stoul(lines[i].substr(11)) <= std::stoul(lines[i - 1].substr(11)))
+      throw std::runtime_error("Lines are out of order: " + lines[i]);
+  }
+
+  Logger::SetAsync(false);
+  Logger::SetSink(nullptr);
+}
+
+void TestConfigure() {
+  lines.clear();
+  Logger::SetSink(Capture);
+  boost::property_tree::ptree config;
+  config.put("odin.logging.level", "warn");
+  Logger::Configure(config);
+  if (!lines.empty() || Logger::IsEnabled(Logger::kInfo, Logger::kRequest))
+    throw std::runtime_error("The level should be warn");
+
+  // An unknown level is reported and falls back to info
+  config.put("odin.logging.level", "warning");
+  Logger::Configure(config);
+  if (lines.size() != 1
+      || lines[0] != "request unknown_logging_level=warning level=info")
+    throw std::runtime_error("Incorrect warning: "
+        + (lines.empty() ? std::string() : lines[0]));
+  if (!Logger::IsEnabled(Logger::kInfo, Logger::kRequest)
+      || Logger::IsEnabled(Logger::kDebug, Logger::kRequest))
+    throw std::runtime_error("The level should be info");
+
+  Logger::SetSink(nullptr);
+}
+
+}
+
+int main() {
+  test::suite suite("logger");
+
+  suite.test(TEST_CASE(TestLevel));
+  suite.test(TEST_CASE(TestSampling));
+  suite.test(TEST_CASE(TestAsync));
+  suite.test(TEST_CASE(TestConfigure));
+
+  return suite.tear_down();
+}
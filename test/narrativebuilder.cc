@@ -96,7 +96,7 @@ void PopulateManeuver(
     bool verbal_multi_cue = false) {
 
   maneuver.set_verbal_formatter(
-      VerbalTextFormatterFactory::Create(country_code, state_code));
+      get_verbal_text_formatter(country_code, state_code));
 
   maneuver.set_type(type);
 
@@ -132,7 +132,7 @@ void PopulateManeuver(
   maneuver.set_internal_intersection(internal_intersection);
 
   // exit_numbers
-  std::vector<Sign>* exit_number_list = maneuver.mutable_signs()
+  SignList* exit_number_list = maneuver.mutable_signs()
       ->mutable_exit_number_list();
   for (auto& sign_items : exit_numbers) {
     exit_number_list->emplace_back(sign_items[0]);
@@ -141,7 +141,7 @@ void PopulateManeuver(
   }
 
   // exit_branches,
-  std::vector<Sign>* exit_branch_list = maneuver.mutable_signs()
+  SignList* exit_branch_list = maneuver.mutable_signs()
       ->mutable_exit_branch_list();
   for (auto& sign_items : exit_branches) {
     exit_branch_list->emplace_back(sign_items[0]);
@@ -150,7 +150,7 @@ void PopulateManeuver(
   }
 
   //  exit_towards,
-  std::vector<Sign>* exit_toward_list = maneuver.mutable_signs()
+  SignList* exit_toward_list = maneuver.mutable_signs()
       ->mutable_exit_toward_list();
   for (auto& sign_items : exit_towards) {
     exit_toward_list->emplace_back(sign_items[0]);
@@ -159,7 +159,7 @@ void PopulateManeuver(
   }
 
   //  exit_names
-  std::vector<Sign>* exit_name_list = maneuver.mutable_signs()
+  SignList* exit_name_list = maneuver.mutable_signs()
       ->mutable_exit_name_list();
   for (auto& sign_items : exit_names) {
     exit_name_list->emplace_back(sign_items[0]);
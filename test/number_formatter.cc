@@ -0,0 +1,147 @@
+#include <string>
+#include <vector>
+#include <locale>
+#include <sstream>
+#include <iomanip>
+
+#include "odin/number_formatter.h"
+#include "odin/util.h"
+
+#include "test.h"
+
+using namespace valhalla::odin;
+
+namespace {
+
+// Separators that differ from the classic locale
+class test_numpunct : public std::numpunct<char> {
+ public:
+  test_numpunct(char decimal_point, char thousands_sep,
+                const std::string& grouping)
+      : decimal_point_(decimal_point),
+        thousands_sep_(thousands_sep),
+        grouping_(grouping) {
+  }
+
+ protected:
+  char do_decimal_point() const override {
+    return decimal_point_;
+  }
+  char do_thousands_sep() const override {
+    return thousands_sep_;
+  }
+  std::string do_grouping() const override {
+    return grouping_;
+  }
+
+  char decimal_point_;
+  char thousands_sep_;
+  std::string grouping_;
+};
+
+std::vector<std::locale> GetTestLocales() {
+  std::vector<std::locale> locales;
+  locales.emplace_back(std::locale::classic());
+  // European style
+  locales.emplace_back(std::locale::classic(), new test_numpunct(',', '.', "\3"));
+  // Indian style
+  locales.emplace_back(std::locale::classic(), new test_numpunct('.', ',', "\3\2"));
+  // Grouping that stops after the first group
+  locales.emplace_back(std::locale::classic(), new test_numpunct(',', ' ', std::string("\2\0", 2)));
+  // All of the narrative locales
+  for (const auto& locale : get_locales()) {
+    locales.emplace_back(locale.second->GetLocale());
+  }
+  return locales;
+}
+
+std::string StreamFormat(const std::locale& locale, float value,
+                         uint32_t precision) {
+  std::stringstream stream;
+  stream.imbue(locale);
+  stream << std::setiosflags(std::ios::fixed) << std::setprecision(precision)
+         << value;
+  return stream.str();
+}
+
+std::string StreamFormat(const std::locale& locale, int value) {
+  std::stringstream stream;
+  stream.imbue(locale);
+  stream << value;
+  return stream.str();
+}
+
+void TryFormat(const NumberFormatter& formatter, const std::locale& locale,
+               float value, uint32_t precision) {
+  std::string expected = StreamFormat(locale, value, precision);
+  std::string formatted = formatter.Format(value, precision);
+  if (formatted != expected) {
+    throw std::runtime_error("Incorrect float format - expected: " + expected
+        + "  |  produced: " + formatted);
+  }
+}
+
+void TryFormat(const NumberFormatter& formatter, const std::locale& locale,
+               int value) {
+  std::string expected = StreamFormat(locale, value);
+  std::string formatted = formatter.Format(value);
+  if (formatted != expected) {
+    throw std::runtime_error("Incorrect int format - expected: " + expected
+        + "  |  produced: " + formatted);
+  }
+}
+
+void TestFloat() {
+  for (const auto& locale : GetTestLocales()) {
+    NumberFormatter formatter(locale);
+    for (float value : { 0.0f, 0.05f, 1.1f, 1.25f, 9.96f, 12.0f, 123.4f,
+        999.95f, 1234.5f, 12345.6f, 123456.7f, 1234567.8f, -5.5f, -4321.1f }) {
+      TryFormat(formatter, locale, value, 0);
+      TryFormat(formatter, locale, value, 1);
+      TryFormat(formatter, locale, value, 3);
+    }
+    // Distances the same way the narrative produces them
+    for (int tenths = 0; tenths < 50000; tenths += 7) {
+      float kilometers = tenths / 10.0f + 0.03f;
+      TryFormat(formatter, locale, kilometers, (tenths % 10 > 0));
+    }
+  }
+}
+
+void TestInt() {
+  for (const auto& locale : GetTestLocales()) {
+    NumberFormatter formatter(locale);
+    for (int value : { 0, 1, 9, 10, 99, 100, 999, 1000, 12345, 123456, 1234567,
+        2147483647, -1, -1000, -2147483647 - 1 }) {
+      TryFormat(formatter, locale, value);
+    }
+  }
+}
+
+void TestBuffer() {
+  NumberFormatter formatter(
+      std::locale(std::locale::classic(), new test_numpunct(',', '.', "\3")));
+  char buffer[8];
+  size_t length = formatter.Format(1234.5, 1, buffer, sizeof(buffer));
+  if (std::string(buffer, length) != "1.234,5")
+    throw std::runtime_error("Incorrect buffer format: "
+        + std::string(buffer, length));
+
+  // Too small for the value
+  if (formatter.Format(1234567.5, 1, buffer, sizeof(buffer)) != 0)
+    throw std::runtime_error("Buffer overflow was not detected");
+  if (formatter.Format(12345678, buffer, sizeof(buffer)) != 0)
+    throw std::runtime_error("Buffer overflow was not detected");
+}
+
+}
+
+int main() {
+  test::suite suite("number_formatter");
+
+  suite.test(TEST_CASE(TestFloat));
+  suite.test(TEST_CASE(TestInt));
+  suite.test(TEST_CASE(TestBuffer));
+
+  return suite.tear_down();
+}
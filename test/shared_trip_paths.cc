@@ -0,0 +1,213 @@
+#include <string>
+#include <vector>
+#include <memory>
+#include <fstream>
+
+#include <unistd.h>
+
+#include "proto/trippath.pb.h"
+#include "odin/shared_trip_paths.h"
+
+#include "test.h"
+
+using namespace valhalla::odin;
+
+namespace {
+
+std::string RingName() {
+  return "/odin_test_" + std::to_string(getpid());
+}
+
+std::string Read(const std::string& handle) {
+  auto trip_path = SharedTripPath::Open(handle.data(), handle.size());
+  return std::string(trip_path.data(), trip_path.size());
+}
+
+void TestHandle() {
+  SharedTripPathRing ring(RingName(), 4096);
+
+  // A serialized trip path is never mistaken for a handle
+  TripPath path;
+  path.add_node()->mutable_edge()->add_name("Main Street");
+  std::string bytes = path.SerializeAsString();
+  if (SharedTripPath::IsHandle(bytes.data(), bytes.size()))
+    throw std::runtime_error("Trip path should not be a handle");
+
+  std::string handle;
+  if (!ring.Write(bytes.data(), bytes.size(), handle)
+      || !SharedTripPath::IsHandle(handle.data(), handle.size()))
+    throw std::runtime_error("Trip path should be written");
+
+  // Parsed in place
+  {
+    auto shared = SharedTripPath::Open(handle.data(), handle.size());
+    TripPath parsed;
+    if (!parsed.ParseFromArray(shared.data(), shared.size())
+        || (parsed.node(0).edge().name(0) != "Main Street"))
+      throw std::runtime_error("Incorrect shared trip path");
+  }
+
+  // Released records are no longer available
+  if (ring.used() != 0)
+    throw std::runtime_error("Record should be released");
+  bool thrown = false;
+  try {
+    Read(handle);
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  if (!thrown)
+    throw std::runtime_error("Released record should not be opened");
+}
+
+void TestWrap() {
+  SharedTripPathRing ring(RingName(), 1000);
+
+  // The ring fills up until the oldest record is released
+  std::vector<std::string> handles(3);
+  std::string trip_path(300, 'a');
+  for (auto& handle : handles) {
+    if (!ring.Write(trip_path.data(), trip_path.size(), handle))
+      throw std::runtime_error("Ring should have room");
+  }
+  std::string handle;
+  if (ring.Write(trip_path.data(), trip_path.size(), handle))
+    throw std::runtime_error("Ring should be full");
+
+  // Out of order releases are reclaimed once the oldest record is released
+  auto second = SharedTripPath::Open(handles[1].data(), handles[1].size());
+  second.Release();
+  if (ring.Write(trip_path.data(), trip_path.size(), handle))
+    throw std::runtime_error("Ring should still be full");
+  Read(handles[0]);
+
+  // Many records of varying sizes go around the ring
+  for (size_t i = 0; i < 200; ++i) {
+    std::string bytes(50 + (i * 37) % 400, static_cast<char>('a' + i % 26));
+    if (!ring.Write(bytes.data(), bytes.size(), handle))
+      throw std::runtime_error("Ring should have room: " + std::to_string(i));
+    if (Read(handle) != bytes)
+      throw std::runtime_error("Incorrect record: " + std::to_string(i));
+    if (i == 0)
+      Read(handles[2]);
+  }
+  if (ring.used() != 0)
+    throw std::runtime_error("Every record should be released");
+}
+
+void TestClaim() {
+  SharedTripPathRing ring(RingName(), 4096);
+  std::string bytes(100, 'a');
+  std::string handle;
+  ring.Write(bytes.data(), bytes.size(), handle);
+
+  // An opened record cannot be opened and released by a second reader
+  auto shared = SharedTripPath::Open(handle.data(), handle.size());
+  bool thrown = false;
+  try {
+    Read(handle);
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  if (!thrown)
+    throw std::runtime_error("Opened record should not be opened again");
+  if (ring.used() == 0)
+    throw std::runtime_error("Opened record should not be released");
+  shared.Release();
+  if (ring.used() != 0)
+    throw std::runtime_error("Record should be released");
+}
+
+// Returns the number of mappings of the test ring in this process
+size_t MappingCount() {
+  std::ifstream maps("/proc/self/maps");
+  size_t count = 0;
+  for (std::string line; std::getline(maps, line);) {
+    if (line.find("/dev/shm" + RingName()) != std::string::npos)
+      ++count;
+  }
+  return count;
+}
+
+void TestRecreate() {
+  std::string bytes(100, 'a');
+  std::string handle;
+  auto ring = std::unique_ptr<SharedTripPathRing>(
+      new SharedTripPathRing(RingName(), 4096));
+  ring->Write(bytes.data(), bytes.size(), handle);
+  auto old_path = SharedTripPath::Open(handle.data(), handle.size());
+
+  // A recreated ring is mapped again, the trip path open in the old mapping
+  // can still be read
+  ring.reset();
+  ring.reset(new SharedTripPathRing(RingName(), 4096));
+  std::string other(200, 'b');
+  ring->Write(other.data(), other.size(), handle);
+  if (Read(handle) != other)
+    throw std::runtime_error("Incorrect record of the recreated ring");
+  if (std::string(old_path.data(), old_path.size()) != bytes)
+    throw std::runtime_error("Open record of the old ring should be readable");
+  size_t count = MappingCount();
+
+  // and the old mapping is unmapped once it is released
+  old_path.Release();
+  if (MappingCount() != count - 1)
+    throw std::runtime_error("Old mapping should be unmapped");
+
+  // as is a replaced mapping without open trip paths
+  ring.reset();
+  ring.reset(new SharedTripPathRing(RingName(), 4096));
+  ring->Write(other.data(), other.size(), handle);
+  Read(handle);
+  if (MappingCount() != count - 1)
+    throw std::runtime_error("Replaced mapping should be unmapped");
+}
+
+void TestFrames() {
+  SharedTripPathRing ring(RingName(), 4096);
+  std::vector<std::string> handles(3);
+  std::vector<std::string> trip_paths = { "first", "second", "third" };
+  for (size_t i = 0; i < handles.size(); ++i) {
+    ring.Write(trip_paths[i].data(), trip_paths[i].size(), handles[i]);
+  }
+  Read(handles[1]);
+
+  {
+    // Every handle is opened even after one that is no longer available
+    TripPathFrames frames;
+    std::string bytes = "bytes";
+    frames.Add(bytes.data(), bytes.size());
+    for (const auto& handle : handles) {
+      frames.Add(handle.data(), handle.size());
+    }
+    frames.Add(handles[0].data(), handles[0].size());
+    if (frames.opened() || (frames.size() != 5))
+      throw std::runtime_error("A handle should not be opened");
+    if ((std::string(frames.data(0), frames.size(0)) != bytes)
+        || (std::string(frames.data(1), frames.size(1)) != trip_paths[0])
+        || (frames.data(2) != nullptr)
+        || (std::string(frames.data(3), frames.size(3)) != trip_paths[2])
+        || (frames.data(4) != frames.data(1)))
+      throw std::runtime_error("Incorrect trip path frames");
+    if (ring.used() == 0)
+      throw std::runtime_error("Records should not be released yet");
+  }
+
+  // All of them are released whichever way the job ends
+  if (ring.used() != 0)
+    throw std::runtime_error("Every record should be released");
+}
+
+}
+
+int main() {
+  test::suite suite("shared_trip_paths");
+
+  suite.test(TEST_CASE(TestHandle));
+  suite.test(TEST_CASE(TestWrap));
+  suite.test(TEST_CASE(TestClaim));
+  suite.test(TEST_CASE(TestRecreate));
+  suite.test(TEST_CASE(TestFrames));
+
+  return suite.tear_down();
+}
@@ -0,0 +1,105 @@
+#include <string>
+#include <utility>
+#include <algorithm>
+
+#include "odin/sign.h"
+#include "odin/sign_list.h"
+
+#include "test.h"
+
+using namespace valhalla::odin;
+
+namespace {
+
+SignList GetSignList(size_t count) {
+  SignList signs;
+  for (size_t i = 0; i < count; ++i) {
+    signs.emplace_back("Exit " + std::to_string(i));
+    signs.back().set_consecutive_count(i);
+  }
+  return signs;
+}
+
+void TryTexts(const SignList& signs, size_t count) {
+  if (signs.size() != count)
+    throw std::runtime_error("Incorrect sign count");
+  size_t i = 0;
+  for (const auto& sign : signs) {
+    if ((sign.text() != ("Exit " + std::to_string(i)))
+        || (sign.consecutive_count() != i))
+      throw std::runtime_error("Incorrect sign at " + std::to_string(i));
+    ++i;
+  }
+}
+
+void TestInline() {
+  SignList signs = GetSignList(2);
+  TryTexts(signs, 2);
+  if (signs.capacity() != 2)
+    throw std::runtime_error("Two signs should be stored in place");
+}
+
+void TestGrow() {
+  // Signs past the inline capacity move to the heap in order
+  for (size_t count : { 0, 1, 2, 3, 5, 17 }) {
+    TryTexts(GetSignList(count), count);
+  }
+
+  // An element of the list can be appended while it grows
+  SignList signs = GetSignList(2);
+  signs.push_back(signs.front());
+  if ((signs.size() != 3) || !(signs.back() == signs.front()))
+    throw std::runtime_error("The appended sign should be a copy");
+}
+
+void TestCopyAndMove() {
+  for (size_t count : { 1, 4 }) {
+    SignList signs = GetSignList(count);
+    SignList copy(signs);
+    TryTexts(copy, count);
+    if (!(copy == signs))
+      throw std::runtime_error("A copy should be equal");
+
+    SignList moved(std::move(copy));
+    TryTexts(moved, count);
+    if (!copy.empty())
+      throw std::runtime_error("A moved list should be empty");
+
+    SignList assigned = GetSignList(3);
+    assigned = std::move(moved);
+    TryTexts(assigned, count);
+    assigned = signs;
+    TryTexts(assigned, count);
+  }
+  if (GetSignList(2) == GetSignList(3))
+    throw std::runtime_error("Lists of different sizes are not equal");
+}
+
+void TestSort() {
+  SignList signs = GetSignList(4);
+  std::sort(signs.begin(), signs.end(), [](const Sign& a, const Sign& b) {
+    return b.consecutive_count() < a.consecutive_count();
+  });
+  if ((signs[0].text() != "Exit 3") || (signs.at(3).text() != "Exit 0"))
+    throw std::runtime_error("Signs should sort in place");
+
+  try {
+    signs.at(4);
+  } catch (const std::out_of_range&) {
+    return;
+  }
+  throw std::runtime_error("at should check the index");
+}
+
+}
+
+int main() {
+  test::suite suite("sign_list");
+
+  suite.test(TEST_CASE(TestInline));
+  suite.test(TEST_CASE(TestGrow));
+  suite.test(TEST_CASE(TestCopyAndMove));
+  suite.test(TEST_CASE(TestSort));
+
+  return suite.tear_down();
+}
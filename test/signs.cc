@@ -13,7 +13,7 @@ namespace {
 
 void PopulateSigns(const std::vector<std::string>& sign_text_list,
                    const std::vector<int>& consecutive_count_list,
-                   std::vector<Sign>* sign_list) {
+                   SignList* sign_list) {
   if (sign_text_list.size() != consecutive_count_list.size())
     throw std::runtime_error("Invalid test input");
 
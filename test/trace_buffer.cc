@@ -0,0 +1,69 @@
+#include <string>
+
+#include "odin/trace_buffer.h"
+
+#include "test.h"
+
+using namespace valhalla::odin;
+
+namespace {
+
+void TestRing() {
+  TraceBuffer trace(4);
+  for (uint32_t i = 0; i < 6; ++i)
+    trace.Add(TraceEvent::kNode, 0, i, i * 10);
+
+  if (trace.size() != 4 || trace.dropped() != 2)
+    throw std::runtime_error("Incorrect size or dropped count");
+
+  // The oldest events were overwritten
+  auto events = trace.GetEvents();
+  for (uint32_t i = 0; i < 4; ++i) {
+    if (events[i].node_index != (i + 2)
+        || events[i].values[0] != static_cast<int32_t>((i + 2) * 10))
+      throw std::runtime_error("Incorrect event " + std::to_string(i));
+  }
+
+  trace.clear();
+  if (trace.size() != 0 || !trace.GetEvents().empty())
+    throw std::runtime_error("Trace should be empty after clear");
+}
+
+void TestSerialize() {
+  TraceBuffer trace(16);
+  trace.Add(TraceEvent::kCombine, TraceEvent::kCombineTurnChannel, 7, 9);
+  trace.Add(TraceEvent::kIntersectingEdge, 1, 8, 270, -90, 3, 3);
+
+  auto events = TraceBuffer::Deserialize(trace.Serialize());
+  if (events.size() != 2 || events[1].values[1] != -90)
+    throw std::runtime_error("Incorrect deserialized events");
+
+  std::string line = TraceBuffer::ToString(events[0]);
+  if (line != "combine node=7 code=combine_turn_channel values=9,0,0,0")
+    throw std::runtime_error("Incorrect event string: " + line);
+
+  // Invalid traces are rejected
+  std::string bytes = trace.Serialize();
+  for (const std::string invalid : { std::string("not a trace"),
+      bytes.substr(0, bytes.size() - 1) }) {
+    bool thrown = false;
+    try {
+      TraceBuffer::Deserialize(invalid);
+    } catch (const std::runtime_error&) {
+      thrown = true;
+    }
+    if (!thrown)
+      throw std::runtime_error("Invalid trace should be rejected");
+  }
+}
+
+}
+
+int main() {
+  test::suite suite("trace_buffer");
+
+  suite.test(TEST_CASE(TestRing));
+  suite.test(TEST_CASE(TestSerialize));
+
+  return suite.tear_down();
+}
@@ -0,0 +1,107 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <iterator>
+
+#include <unistd.h>
+
+#include "odin/trace_files.h"
+
+#include "test.h"
+
+using namespace valhalla::odin;
+
+namespace {
+
+bool Exists(const std::string& file_name) {
+  return access(file_name.c_str(), F_OK) == 0;
+}
+
+std::string ReadFile(const std::string& file_name) {
+  std::ifstream file(file_name, std::ios::binary);
+  return std::string((std::istreambuf_iterator<char>(file)),
+                     std::istreambuf_iterator<char>());
+}
+
+void TestWrite() {
+  TraceFiles files("/tmp", 0);
+  TraceBuffer trace(16);
+  trace.Add(TraceEvent::kNode, 0, 3, 90);
+  std::string file_name = files.Write(getpid(), 2, trace);
+
+  auto events = TraceBuffer::Deserialize(ReadFile(file_name));
+  std::remove(file_name.c_str());
+  std::string prefix = "/tmp/odin_trace_" + std::to_string(getpid()) + "_";
+  std::string suffix = "_" + std::to_string(getpid()) + "_2.bin";
+  if ((file_name.compare(0, prefix.size(), prefix) != 0)
+      || (file_name.size() < prefix.size() + suffix.size())
+      || (file_name.compare(file_name.size() - suffix.size(), suffix.size(),
+                            suffix) != 0))
+    throw std::runtime_error("Incorrect trace file name: " + file_name);
+  if (events.size() != 1 || events[0].node_index != 3)
+    throw std::runtime_error("The trace was not read back");
+}
+
+void TestBounded() {
+  // Only the newest files are kept
+  TraceFiles files("/tmp", 2);
+  TraceBuffer trace(16);
+  std::vector<std::string> names;
+  for (size_t leg = 0; leg < 4; ++leg) {
+    trace.Add(TraceEvent::kNode, 0, leg);
+    names.push_back(files.Write(getpid(), leg, trace));
+  }
+  if (Exists(names[0]) || Exists(names[1]))
+    throw std::runtime_error("The oldest traces should be removed");
+  if (!Exists(names[2]) || !Exists(names[3]))
+    throw std::runtime_error("The newest traces should be kept");
+  for (const auto& name : names)
+    std::remove(name.c_str());
+}
+
+void TestWorkers() {
+  // Workers tracing the same request keep their own files
+  TraceFiles first("/tmp", 1), second("/tmp", 1);
+  TraceBuffer trace(16);
+  trace.Add(TraceEvent::kNode, 0, 1);
+  auto first_name = first.Write(getpid(), 0, trace);
+  trace.Add(TraceEvent::kNode, 0, 2);
+  auto second_name = second.Write(getpid(), 0, trace);
+  if (first_name == second_name)
+    throw std::runtime_error("Workers should not share a trace file");
+  if (TraceBuffer::Deserialize(ReadFile(first_name)).size() != 1)
+    throw std::runtime_error("The trace of a worker was overwritten");
+
+  // Rewriting a file keeps it
+  first.Write(getpid(), 0, trace);
+  if (!Exists(first_name) || !Exists(second_name))
+    throw std::runtime_error("The rewritten trace should be kept");
+  std::remove(first_name.c_str());
+  std::remove(second_name.c_str());
+}
+
+void TestWriteError() {
+  TraceFiles files("/nonexistent_odin_trace_directory", 2);
+  bool thrown = false;
+  try {
+    files.Write(1, 0, TraceBuffer(16));
+  } catch (const std::runtime_error&) {
+    thrown = true;
+  }
+  if (!thrown)
+    throw std::runtime_error("A trace that cannot be written should throw");
+}
+
+}
+
+int main() {
+  test::suite suite("trace_files");
+
+  suite.test(TEST_CASE(TestWrite));
+  suite.test(TEST_CASE(TestBounded));
+  suite.test(TEST_CASE(TestWorkers));
+  suite.test(TEST_CASE(TestWriteError));
+
+  return suite.tear_down();
+}
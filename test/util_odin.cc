@@ -113,6 +113,73 @@ namespace {
 
   }
 
+  void test_dictionary_time() {
+    for (const auto& locale : get_locales()) {
+      const NarrativeDictionary& dictionary = *locale.second;
+      for (const auto& date_time : { "2014-01-02T00:00-05:00",
+          "2014-01-02T07:01-05:00", "2014-01-02T12:00+01:00",
+          "2014-01-02T15:30+01:00", "2014-01-02T23:59+01:00",
+          "2014-01-02T24:00+01:00", "2014-01-02T08:45", "20140101", "Blah",
+          "2014-01-02T25:00-05:00", "2014-13-02T08:00-05:00" }) {
+        std::string expected = get_localized_time(date_time, dictionary.GetLocale());
+        std::string localized_time = get_localized_time(date_time, dictionary);
+        if (localized_time != expected)
+          throw std::runtime_error("Incorrect Time: " + localized_time + " ---> "
+                                   + expected + " for locale: " + locale.first);
+
+        expected = get_localized_date(date_time, dictionary.GetLocale());
+        std::string localized_date = get_localized_date(date_time, dictionary);
+        if (localized_date != expected)
+          throw std::runtime_error("Incorrect Date: " + localized_date + " ---> "
+                                   + expected + " for locale: " + locale.first);
+      }
+    }
+
+    // Midnight at the end of a day is the start of the next day
+    try_get_formatted_date("2014-01-02T24:00-05:00","01/03/14",std::locale());
+    try_get_formatted_time("2014-13-02T08:00-05:00","",std::locale());
+    try_get_formatted_time("2014-01-02T08:60-05:00","",std::locale());
+  }
+
+  void try_parse_date_time(const std::string& date_time, bool expected_parsed,
+                           int64_t expected_local_time,
+                           int16_t expected_tz_offset) {
+    int64_t local_time = 0;
+    int16_t tz_offset = 0;
+    bool parsed = parse_date_time(date_time, local_time, tz_offset);
+    if (parsed != expected_parsed)
+      throw std::runtime_error("Incorrect parse result for: " + date_time);
+    if (parsed && (local_time != expected_local_time || tz_offset != expected_tz_offset))
+      throw std::runtime_error("Incorrect local time: " + std::to_string(local_time)
+                               + " tz offset: " + std::to_string(tz_offset)
+                               + " for: " + date_time);
+  }
+
+  void test_parse_date_time() {
+    try_parse_date_time("1970-01-01T00:00+00:00", true, 0, 0);
+    try_parse_date_time("2014-01-02T23:59-05:00", true, 1388707140, -300);
+    try_parse_date_time("2014-01-02T24:00+01:00", true, 1388707200, 60);
+    try_parse_date_time("2015-05-06T08:00+05:30", true, 1430899200, 330);
+    try_parse_date_time("2015-05-06T08:00", true, 1430899200, 0);
+    try_parse_date_time("20140101", false, 0, 0);
+    try_parse_date_time("Blah", false, 0, 0);
+
+    // The local time formats the same as the date time string
+    const NarrativeDictionary& dictionary = *get_locales().at("en-US");
+    for (const auto& date_time : { "2014-01-02T07:01-05:00",
+        "2014-01-02T23:59+01:00", "2014-01-02T24:00+01:00" }) {
+      int64_t local_time = 0;
+      int16_t tz_offset = 0;
+      parse_date_time(date_time, local_time, tz_offset);
+      if (get_localized_time(local_time, dictionary)
+          != get_localized_time(date_time, dictionary))
+        throw std::runtime_error("Incorrect local time format for: "
+                                 + std::string(date_time));
+    }
+    if (!get_localized_time(-1, dictionary).empty())
+      throw std::runtime_error("Invalid local time should not be formatted");
+  }
+
   void test_supported_locales() {
     //crack open english
     const auto& jsons = get_locales_json();
@@ -194,6 +261,8 @@ int main() {
   suite.test(TEST_CASE(test_get_locales));
   suite.test(TEST_CASE(test_time));
   suite.test(TEST_CASE(test_date));
+  suite.test(TEST_CASE(test_dictionary_time));
+  suite.test(TEST_CASE(test_parse_date_time));
 
   return suite.tear_down();
 }
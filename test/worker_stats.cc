@@ -0,0 +1,87 @@
+#include <string>
+
+#include "odin/worker_stats.h"
+
+#include "test.h"
+
+using namespace valhalla::odin;
+
+namespace {
+
+void TestBuckets() {
+  // Every latency is within the limits of its bucket
+  uint64_t previous_limit = 0;
+  for (size_t bucket = 1; bucket < LatencyHistogram::kBucketCount; ++bucket) {
+    uint64_t limit = LatencyHistogram::GetBucketLimit(bucket);
+    if (limit <= previous_limit)
+      throw std::runtime_error("Bucket limits should increase: "
+          + std::to_string(bucket));
+    if ((LatencyHistogram::GetBucket(limit) != bucket)
+        || (LatencyHistogram::GetBucket(previous_limit + 1) != bucket))
+      throw std::runtime_error("Incorrect bucket limits: "
+          + std::to_string(bucket));
+    previous_limit = limit;
+  }
+
+  // Huge latencies go to the last bucket
+  if (LatencyHistogram::GetBucket(UINT64_MAX)
+      != (LatencyHistogram::kBucketCount - 1))
+    throw std::runtime_error("Incorrect bucket of the largest latency");
+}
+
+void TestPercentile() {
+  LatencyHistogram histogram;
+  for (uint64_t i = 1; i <= 100; ++i)
+    histogram.Record(i * 1000);
+
+  LatencyHistogram::counts_t counts{};
+  uint64_t sum = 0;
+  histogram.AddTo(counts, sum);
+  if (sum != 5050000)
+    throw std::runtime_error("Incorrect sum: " + std::to_string(sum));
+
+  // Buckets are within 25% of the latency
+  uint64_t p50 = LatencyHistogram::GetPercentile(counts, 0.5);
+  uint64_t p99 = LatencyHistogram::GetPercentile(counts, 0.99);
+  if ((p50 < 50000) || (p50 > 62500))
+    throw std::runtime_error("Incorrect p50: " + std::to_string(p50));
+  if ((p99 < 99000) || (p99 > 125000))
+    throw std::runtime_error("Incorrect p99: " + std::to_string(p99));
+}
+
+void TestToJson() {
+  {
+    WorkerStats stats;
+    WorkerStats other_stats;
+    stats.RecordLeg(100, 7);
+    other_stats.RecordLeg(50, 3);
+    stats.RecordError(202);
+    stats.RecordError(999);
+    stats.Record(WorkerStats::kRequest, 2000);
+
+    std::string json = WorkerStats::ToJson();
+    for (const std::string expected : { "\"workers\":2", "\"legs\":2",
+        "\"nodes\":150", "\"maneuvers\":10", "\"errors\":{\"202\":1}",
+        "\"request\":{\"count\":1" }) {
+      if (json.find(expected) == std::string::npos)
+        throw std::runtime_error("Missing " + expected + " in " + json);
+    }
+  }
+
+  // Destroyed stats are no longer exported
+  std::string json = WorkerStats::ToJson();
+  if (json.find("\"workers\":0") == std::string::npos)
+    throw std::runtime_error("Stats should be unregistered: " + json);
+}
+
+}
+
+int main() {
+  test::suite suite("worker_stats");
+
+  suite.test(TEST_CASE(TestBuckets));
+  suite.test(TEST_CASE(TestPercentile));
+  suite.test(TEST_CASE(TestToJson));
+
+  return suite.tear_down();
+}
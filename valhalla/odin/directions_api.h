@@ -0,0 +1,61 @@
+#ifndef VALHALLA_ODIN_DIRECTIONS_API_H_
+#define VALHALLA_ODIN_DIRECTIONS_API_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+#include <valhalla/proto/tripdirections.pb.h>
+#include <valhalla/proto/directions_options.pb.h>
+
+namespace valhalla {
+namespace odin {
+
+/**
+ * Buffer the serialized trip directions are written into. Reusing a buffer
+ * across calls reuses its memory.
+ */
+class OutputBuffer {
+ public:
+  const uint8_t* data() const;
+  size_t size() const;
+  void clear();
+
+  /**
+   * Returns the underlying bytes, moving them out leaves the buffer empty.
+   */
+  std::string& bytes();
+
+ protected:
+  std::string bytes_;
+
+};
+
+/**
+ * Builds the directions of a serialized trip path in process, without going
+ * through the odin service. Safe to call from any number of threads at once.
+ * An unsupported language falls back to the default language like the
+ * service does.
+ * Throws valhalla_exception_t with error code 201 if the trip path cannot be
+ * parsed and with the error code of the failure or 202 if the directions
+ * cannot be built.
+ *
+ * @param  trip_path   The serialized trip path.
+ * @param  size        The size of the serialized trip path.
+ * @param  options     The directions options such as units and language.
+ * @param  output      The buffer the serialized trip directions are written
+ *                     to, replacing its contents.
+ */
+void BuildDirections(const uint8_t* trip_path, size_t size,
+                     const DirectionsOptions& options, OutputBuffer& output);
+
+/**
+ * Same as above but returns the trip directions without serializing them.
+ */
+TripDirections BuildDirections(const uint8_t* trip_path, size_t size,
+                               const DirectionsOptions& options);
+
+}
+}
+
+#endif  // VALHALLA_ODIN_DIRECTIONS_API_H_
@@ -0,0 +1,49 @@
+#ifndef VALHALLA_ODIN_DIRECTIONS_API_C_H_
+#define VALHALLA_ODIN_DIRECTIONS_API_C_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * C interface of the in process directions API, see directions_api.h.
+ * Every function is safe to call from any number of threads at once as long
+ * as each thread uses its own output buffer.
+ */
+
+/* Buffer the serialized TripDirections protobuf is written into */
+typedef struct odin_output_buffer odin_output_buffer;
+
+odin_output_buffer* odin_output_buffer_new(void);
+void odin_output_buffer_free(odin_output_buffer* output);
+const uint8_t* odin_output_buffer_data(const odin_output_buffer* output);
+size_t odin_output_buffer_size(const odin_output_buffer* output);
+
+/*
+ * Builds the directions of a serialized TripPath protobuf into the output
+ * buffer. The options are the json directions_options of a service request,
+ * for example {"units":"miles","language":"de-DE"}, or NULL for the default
+ * options.
+ *
+ * Returns 0 on success or the odin error code of the failure, in which case
+ * odin_error_message describes it. Error code 299 means the options are not
+ * valid json.
+ */
+int odin_build_directions(const uint8_t* trip_path, size_t trip_path_size,
+                          const char* options_json,
+                          odin_output_buffer* output);
+
+/*
+ * Returns the message of the last failure of odin_build_directions in the
+ * calling thread. The message is valid until the next call in that thread.
+ */
+const char* odin_error_message(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* VALHALLA_ODIN_DIRECTIONS_API_C_H_ */
@@ -0,0 +1,127 @@
+#ifndef VALHALLA_ODIN_DIRECTIONS_BATCH_H_
+#define VALHALLA_ODIN_DIRECTIONS_BATCH_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+#include <valhalla/proto/directions_options.pb.h>
+#include <valhalla/odin/stage_times.h>
+#include <valhalla/odin/trace_buffer.h>
+
+namespace valhalla {
+namespace odin {
+
+/**
+ * Builds the directions of several serialized trip paths at once. The legs
+ * are grouped by their directions options so the legs of a locale are built
+ * back to back, and they are spread over a pool of threads when the batch
+ * has more than one thread. The result of each leg is independent of the
+ * others, a leg that fails does not stop the batch.
+ */
+class DirectionsBatch {
+ public:
+  struct Result {
+    std::string directions;       // The serialized trip directions
+    std::vector<std::string> translations;  // One per additional language
+    uint32_t error_code;          // 0 if built, 201 or 202 otherwise
+    uint32_t node_count;
+    uint32_t maneuver_count;
+    uint64_t parse_nanoseconds;
+    uint64_t serialize_nanoseconds;
+    StageTimes stage_times;       // Only timed if Build was asked to
+  };
+
+  /**
+   * Constructor.
+   *
+   * @param  thread_count  The number of threads building the legs, including
+   *                       the thread calling Build.
+   */
+  explicit DirectionsBatch(uint32_t thread_count = 1);
+
+  ~DirectionsBatch();
+
+  DirectionsBatch(const DirectionsBatch&) = delete;
+  DirectionsBatch& operator=(const DirectionsBatch&) = delete;
+
+  /**
+   * Adds directions options to the batch. Identical options are only kept
+   * once.
+   *
+   * @return the index of the options to add legs with.
+   */
+  size_t AddOptions(const DirectionsOptions& options);
+
+  /**
+   * Adds a leg to the batch. The trip path bytes are not copied, they must
+   * stay valid until Build returns.
+   *
+   * @param  options_index  The index returned by AddOptions.
+   * @param  trip_path      The serialized trip path.
+   * @param  size           The size of the serialized trip path.
+   * @param  trace          The optional trace buffer of this leg.
+   * @return the index of the leg result.
+   */
+  size_t Add(size_t options_index, const char* trip_path, size_t size,
+             TraceBuffer* trace = nullptr);
+
+  /**
+   * Builds the directions of every leg added since the last clear.
+   *
+   * @param  time_stages  Whether the stages of each leg are timed.
+   */
+  void Build(bool time_stages = false);
+
+  Result& GetResult(size_t leg);
+
+  size_t size() const;
+  size_t options_count() const;
+  uint32_t thread_count() const;
+
+  /**
+   * Removes the legs and the options, keeping the allocated results.
+   */
+  void clear();
+
+ protected:
+  struct leg_t {
+    size_t options_index;
+    const char* trip_path;
+    size_t size;
+    TraceBuffer* trace;
+  };
+
+  void BuildLeg(size_t leg);
+  void BuildNextLegs();
+  void RunThread();
+
+  std::vector<DirectionsOptions> options_;
+  std::unordered_map<std::string, size_t> options_indexes_;
+  std::vector<leg_t> legs_;
+  std::vector<Result> results_;
+  std::vector<size_t> order_;
+  bool time_stages_;
+
+  // The pool takes the legs in order until there are none left
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable started_;
+  std::condition_variable finished_;
+  uint64_t generation_;
+  size_t running_;
+  bool stop_;
+  std::atomic<size_t> next_;
+
+};
+
+}
+}
+
+#endif  // VALHALLA_ODIN_DIRECTIONS_BATCH_H_
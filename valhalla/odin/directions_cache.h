@@ -0,0 +1,111 @@
+#ifndef VALHALLA_ODIN_DIRECTIONS_CACHE_H_
+#define VALHALLA_ODIN_DIRECTIONS_CACHE_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <list>
+#include <unordered_map>
+
+namespace valhalla {
+namespace odin {
+
+/**
+ * Least recently used cache of serialized trip directions keyed by the
+ * content of the trip path and the directions options that produced them.
+ * The key holds a hash of the trip path, which can collide, so each entry
+ * keeps the bytes of its trip path and they are compared on a hit.
+ * The cache is not thread safe, each worker owns its own cache.
+ */
+class DirectionsCache {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param  max_bytes  The memory budget of the cached keys and directions.
+   *                    A budget of 0 disables the cache.
+   */
+  explicit DirectionsCache(size_t max_bytes);
+
+  /**
+   * Returns a 64 bit hash of the specified bytes, 8 bytes at a time.
+   *
+   * @param  data  The bytes to hash.
+   * @param  size  The number of bytes.
+   * @param  seed  The hash of the preceding bytes when hashing in pieces.
+   * @return the hash.
+   */
+  static uint64_t HashBytes(const void* data, size_t size, uint64_t seed = 0);
+
+  /**
+   * Returns the key of the specified serialized trip path and options.
+   * The trip path is represented by a hash of its bytes and its size.
+   *
+   * @param  trip_path  The serialized trip path.
+   * @param  size  The size of the serialized trip path.
+   * @param  directions_options  The serialized directions options.
+   * @return the cache key.
+   */
+  static std::string MakeKey(const void* trip_path, size_t size,
+                             const std::string& directions_options);
+
+  /**
+   * Returns the cached directions of the specified key and trip path and
+   * marks them as the most recently used.
+   *
+   * @param  key  The cache key.
+   * @param  trip_path  The serialized trip path of the key.
+   * @param  size  The size of the serialized trip path.
+   * @return a pointer to the serialized directions or nullptr if they are
+   *         not cached. The pointer is valid until the next Insert.
+   */
+  const std::string* Find(const std::string& key, const void* trip_path,
+                          size_t size);
+
+  /**
+   * Caches the specified directions, evicting the least recently used
+   * directions until the cache fits in its memory budget. The directions
+   * of another trip path with the same key are replaced.
+   *
+   * @param  key  The cache key.
+   * @param  trip_path  The serialized trip path of the key.
+   * @param  size  The size of the serialized trip path.
+   * @param  directions  The serialized directions.
+   */
+  void Insert(const std::string& key, const void* trip_path, size_t size,
+              const std::string& directions);
+
+  bool enabled() const;
+  size_t max_bytes() const;
+  size_t bytes() const;
+  size_t size() const;
+  uint64_t hits() const;
+  uint64_t misses() const;
+  uint64_t evictions() const;
+
+ protected:
+  struct entry_t {
+    std::string key;
+    std::string trip_path;
+    std::string directions;
+  };
+
+  // Removes the least recently used entry
+  void Evict();
+
+  // Most recently used entries first
+  std::list<entry_t> entries_;
+  std::unordered_map<std::string, std::list<entry_t>::iterator> index_;
+
+  size_t max_bytes_;
+  size_t bytes_;
+  uint64_t hits_;
+  uint64_t misses_;
+  uint64_t evictions_;
+
+};
+
+}
+}
+
+#endif  // VALHALLA_ODIN_DIRECTIONS_CACHE_H_
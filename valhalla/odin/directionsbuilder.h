@@ -2,12 +2,15 @@
 #define VALHALLA_ODIN_DIRECTIONSBUILDER_H_
 
 #include <list>
+#include <vector>
 
 #include <valhalla/proto/trippath.pb.h>
 #include <valhalla/proto/tripdirections.pb.h>
 #include <valhalla/proto/directions_options.pb.h>
 #include <valhalla/odin/maneuver.h>
 #include <valhalla/odin/enhancedtrippath.h>
+#include <valhalla/odin/stage_times.h>
+#include <valhalla/odin/trace_buffer.h>
 
 namespace valhalla {
 namespace odin {
@@ -30,12 +33,51 @@ class DirectionsBuilder {
    * @param directions_options The directions options such as: units and
    *                           language.
    * @param trip_path The trip path - list of nodes, edges, attributes and shape.
+   * @param stage_times The optional stage times that the elapsed time of
+   *                    each stage is added to.
+   * @param trace The optional trace buffer that records the maneuver
+   *              decisions.
    */
   TripDirections Build(const DirectionsOptions& directions_options,
-                       TripPath& trip_path);
+                       TripPath& trip_path,
+                       StageTimes* stage_times = nullptr,
+                       TraceBuffer* trace = nullptr);
+
+  /**
+   * Returns the trip directions in the language of the directions options
+   * followed by the trip directions in each of its additional languages.
+   * The maneuvers are built once and only the narrative is built again for
+   * each language.
+   *
+   * @param directions_options The directions options such as: units,
+   *                           language and additional languages.
+   * @param trip_path The trip path - list of nodes, edges, attributes and shape.
+   * @param stage_times The optional stage times that the elapsed time of
+   *                    each stage is added to.
+   * @param trace The optional trace buffer that records the maneuver
+   *              decisions.
+   */
+  std::vector<TripDirections> BuildLanguages(
+      const DirectionsOptions& directions_options, TripPath& trip_path,
+      StageTimes* stage_times = nullptr, TraceBuffer* trace = nullptr);
 
  protected:
 
+  /**
+   * Returns the maneuvers of the trip path without their narrative.
+   */
+  std::list<Maneuver> BuildManeuvers(
+      const DirectionsOptions& directions_options, EnhancedTripPath* etp,
+      StageTimes* stage_times, TraceBuffer* trace);
+
+  /**
+   * Sets the instructions of the maneuvers in the language of the
+   * directions options.
+   */
+  void BuildNarrative(const DirectionsOptions& directions_options,
+                      EnhancedTripPath* etp, std::list<Maneuver>& maneuvers,
+                      StageTimes* stage_times);
+
   /**
    * Update the heading of ~0 length edges.
    *
@@ -51,11 +93,13 @@ class DirectionsBuilder {
    * @param etp The enhanced trip path - list of nodes, edges, attributes and shape.
    * @param maneuvers the maneuver list that contains the information required
    *                  to populate the trip directions.
+   * @param last_use Whether the maneuvers are not used again, their transit
+   *                 stop strings are then moved into the trip directions.
    * @returns the trip directions.
    */
   TripDirections PopulateTripDirections(
       const DirectionsOptions& directions_options, EnhancedTripPath* etp,
-      std::list<Maneuver>& maneuvers);
+      std::list<Maneuver>& maneuvers, bool last_use);
 
 };
 
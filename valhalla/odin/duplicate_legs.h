@@ -0,0 +1,67 @@
+#ifndef VALHALLA_ODIN_DUPLICATE_LEGS_H_
+#define VALHALLA_ODIN_DUPLICATE_LEGS_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace valhalla {
+namespace odin {
+
+/**
+ * Finds the legs of a request whose serialized trip paths only differ in
+ * their leg id, such as the repeated legs of a tour, so their directions
+ * are built once. The directions of a duplicate are those of the first
+ * identical leg with the leg id patched in place of serializing them again.
+ */
+class DuplicateLegs {
+ public:
+  /**
+   * Adds the next leg of the request.
+   *
+   * @param  trip_path  The serialized trip path, which must stay valid until
+   *                    the following clear.
+   * @param  size       The size of the serialized trip path.
+   * @return the index of the first leg identical to this one apart from the
+   *         leg id, or the index of this leg if there was none.
+   */
+  size_t Add(const char* trip_path, size_t size);
+
+  /**
+   * Sets the leg id of the specified serialized trip directions of an
+   * identical leg to the leg id of the trip path of the specified leg.
+   *
+   * @param  leg         The index of the leg the directions are for.
+   * @param  directions  The serialized trip directions to patch.
+   */
+  void SetLegId(size_t leg, std::string& directions) const;
+
+  void clear();
+  size_t size() const;
+
+ protected:
+  struct leg_t {
+    const char* trip_path;
+    size_t size;
+    // Where the leg id field is in the trip path and its size, 0 if the
+    // trip path has none
+    size_t leg_id_offset;
+    size_t leg_id_size;
+    // The serialized leg id field of the directions, which always have one
+    std::string leg_id;
+  };
+
+  // Whether two legs are identical apart from their leg ids
+  bool Equal(const leg_t& a, const leg_t& b) const;
+
+  std::vector<leg_t> legs_;
+  std::unordered_multimap<uint64_t, size_t> index_;
+
+};
+
+}
+}
+
+#endif  // VALHALLA_ODIN_DUPLICATE_LEGS_H_
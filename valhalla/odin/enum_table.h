@@ -0,0 +1,44 @@
+#ifndef VALHALLA_ODIN_ENUM_TABLE_H_
+#define VALHALLA_ODIN_ENUM_TABLE_H_
+
+#include <cstddef>
+
+#include <valhalla/baldr/errorcode_util.h>
+
+namespace valhalla {
+namespace odin {
+
+/**
+ * Dense translation of the values of a trip path enum into the values of the
+ * matching trip directions enum. The table is indexed by the trip path value,
+ * so it must list every value from 0 to N - 1 in order, which IsDense checks
+ * at compile time. A value outside of the table throws.
+ */
+template <class From, class To, size_t N>
+struct EnumTable {
+  struct Entry {
+    From from;
+    To to;
+  };
+
+  Entry entries[N];
+
+  // A single return statement so it is constexpr in C++11
+  constexpr bool IsDense(size_t i = 0) const {
+    return (i == N)
+        || ((static_cast<size_t>(entries[i].from) == i) && IsDense(i + 1));
+  }
+
+  To operator[](From from) const {
+    auto index = static_cast<size_t>(from);
+    if (index >= N) {
+      throw valhalla::baldr::valhalla_exception_t{500, 202};
+    }
+    return entries[index].to;
+  }
+};
+
+}
+}
+
+#endif  // VALHALLA_ODIN_ENUM_TABLE_H_
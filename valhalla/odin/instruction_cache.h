@@ -0,0 +1,134 @@
+#ifndef VALHALLA_ODIN_INSTRUCTION_CACHE_H_
+#define VALHALLA_ODIN_INSTRUCTION_CACHE_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <array>
+#include <vector>
+#include <initializer_list>
+#include <mutex>
+#include <atomic>
+#include <unordered_map>
+
+namespace valhalla {
+namespace odin {
+
+/**
+ * Bounded cache of rendered instructions that is shared by every request
+ * and every thread of the process. Keys are split across shards that each
+ * have their own lock. A shard is emptied when it is full, which keeps the
+ * cache bounded without tracking how recently each instruction was used.
+ */
+class InstructionCache {
+ public:
+  // A phrase tag and the value that replaces it
+  struct PhraseTag {
+    const char* tag;
+    const std::string& value;
+  };
+
+  /**
+   * Picks the bucket of a rendered instruction from the address of its tagged
+   * phrase and a hash of its tag values. The tagged phrases must live as long
+   * as the cache, as those of the locales do. A hash can collide so the tag
+   * values are compared too.
+   */
+  struct Key {
+    const std::string* phrase;
+    uint64_t tag_values;
+
+    bool operator==(const Key& other) const {
+      return (phrase == other.phrase) && (tag_values == other.tag_values);
+    }
+  };
+
+  /**
+   * Returns the key of the specified tagged phrase and tag values.
+   *
+   * @param  phrase  The tagged phrase.
+   * @param  phrase_tags  The phrase tags and their values.
+   */
+  static Key GetKey(const std::string& phrase,
+                    std::initializer_list<PhraseTag> phrase_tags);
+
+  /**
+   * Constructor.
+   *
+   * @param  max_entries  The maximum number of cached instructions.
+   *                      A maximum of 0 disables the cache.
+   */
+  explicit InstructionCache(size_t max_entries = 0);
+
+  /**
+   * Sets the maximum number of cached instructions and empties the cache.
+   * Not thread safe, it must be called before the cache is shared.
+   *
+   * @param  max_entries  The maximum number of cached instructions.
+   */
+  void set_max_entries(size_t max_entries);
+
+  /**
+   * Copies the cached instruction of the specified tag values.
+   *
+   * @param  key  The key of the tagged phrase and its tag values.
+   * @param  phrase_tags  The phrase tags and their values.
+   * @param  instruction  The cached instruction.
+   * @return true if the instruction was cached.
+   */
+  bool Find(const Key& key, std::initializer_list<PhraseTag> phrase_tags,
+            std::string& instruction);
+
+  /**
+   * Caches the specified instruction, replacing the instruction of other tag
+   * values with the same key.
+   *
+   * @param  key  The key of the tagged phrase and its tag values.
+   * @param  phrase_tags  The phrase tags and their values.
+   * @param  instruction  The rendered instruction.
+   */
+  void Insert(const Key& key, std::initializer_list<PhraseTag> phrase_tags,
+              const std::string& instruction);
+
+  bool enabled() const;
+  size_t max_entries() const;
+  size_t size();
+  uint64_t hits() const;
+  uint64_t misses() const;
+  uint64_t evictions() const;
+
+ protected:
+  static constexpr size_t kShardCount = 16;
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      // The phrases are aligned so the low bits of their address are unused
+      return (reinterpret_cast<uintptr_t>(key.phrase) >> 3) ^ key.tag_values;
+    }
+  };
+
+  struct Entry {
+    std::vector<std::string> tag_values;
+    std::string instruction;
+  };
+
+  struct Shard {
+    std::mutex mutex;
+    std::unordered_map<Key, Entry, KeyHash> instructions;
+  };
+
+  Shard& GetShard(const Key& key);
+
+  std::array<Shard, kShardCount> shards_;
+  size_t max_entries_;
+  size_t max_shard_entries_;
+  std::atomic<uint64_t> hits_;
+  std::atomic<uint64_t> misses_;
+  std::atomic<uint64_t> evictions_;
+
+};
+
+}
+}
+
+#endif  // VALHALLA_ODIN_INSTRUCTION_CACHE_H_
@@ -0,0 +1,89 @@
+#ifndef VALHALLA_ODIN_JOB_CAPTURE_H_
+#define VALHALLA_ODIN_JOB_CAPTURE_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <fstream>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace valhalla {
+namespace odin {
+
+/**
+ * The frames of a job as odin_worker_t received them: the request json
+ * followed by the serialized trip path of each leg.
+ */
+struct CapturedJob {
+  uint64_t timestamp;  // Nanoseconds since the epoch
+  std::vector<std::string> frames;
+};
+
+/**
+ * Writes the jobs of a worker to rolling capture files for odin_replay.
+ * A new file is started once the current one reaches its maximum size and
+ * the oldest files are removed so at most max_files are kept.
+ */
+class JobCapture {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param  directory       The directory the capture files are written to.
+   * @param  max_file_bytes  The size a file reaches before the next one.
+   * @param  max_files       The number of files kept, 0 keeps every file.
+   */
+  JobCapture(const std::string& directory, size_t max_file_bytes,
+             size_t max_files);
+
+  /**
+   * Appends a job to the current capture file. The frame type only needs
+   * data() and size() so both zmq messages and strings can be captured.
+   * Throws std::runtime_error if the capture cannot be written.
+   */
+  template <class frame_t>
+  void Write(const std::list<frame_t>& frames) {
+    BeginJob(frames.size());
+    for (const auto& frame : frames) {
+      WriteFrame(frame.data(), frame.size());
+    }
+    EndJob();
+  }
+
+  /**
+   * Appends a job frame by frame, for frames that are not stored together.
+   * BeginJob is followed by frame_count calls to WriteFrame, then EndJob.
+   * Throws std::runtime_error if the capture cannot be written.
+   */
+  void BeginJob(size_t frame_count);
+  void WriteFrame(const void* data, size_t size);
+  void EndJob();
+
+  /**
+   * Returns the jobs of a capture file in order.
+   * Throws std::runtime_error if the file is not a valid capture.
+   */
+  static std::vector<CapturedJob> Read(const std::string& file_name);
+
+  const std::string& file_name() const;
+
+ protected:
+  void Roll();
+
+  std::string directory_;
+  size_t max_file_bytes_;
+  size_t max_files_;
+  uint32_t worker_;
+  uint32_t file_index_;
+  std::string file_name_;
+  std::list<std::string> file_names_;
+  std::ofstream file_;
+  size_t file_bytes_;
+
+};
+
+}
+}
+
+#endif  // VALHALLA_ODIN_JOB_CAPTURE_H_
@@ -0,0 +1,91 @@
+#ifndef VALHALLA_ODIN_LENGTH_PHRASE_TABLE_H_
+#define VALHALLA_ODIN_LENGTH_PHRASE_TABLE_H_
+
+#include <vector>
+#include <string>
+
+#include <valhalla/odin/number_formatter.h>
+
+namespace valhalla {
+namespace odin {
+
+/**
+ * Precomputed length phrases for one set of metric and US customary length
+ * phrases of a locale. Spoken lengths are quantized to tenths of a
+ * kilometer/mile, rounded meters or rounded feet so, up to a maximum length,
+ * every length maps to an already rendered phrase.
+ */
+class LengthPhraseTable {
+ public:
+  LengthPhraseTable();
+
+  /**
+   * Constructor that renders the length phrases for every quantized length.
+   *
+   * @param  metric_lengths  The metric length phrases.
+   * @param  us_customary_lengths  The US customary length phrases.
+   * @param  number_formatter  The number formatter of the locale.
+   */
+  LengthPhraseTable(const std::vector<std::string>& metric_lengths,
+                    const std::vector<std::string>& us_customary_lengths,
+                    const NumberFormatter& number_formatter);
+
+  /**
+   * Returns the metric length phrase of the specified kilometer value.
+   *
+   * @param kilometers The length value to process.
+   *
+   * @return the metric length phrase of the specified length value.
+   */
+  std::string GetMetricLength(float kilometers) const;
+
+  /**
+   * Returns the US customary length phrase of the specified miles value.
+   *
+   * @param miles The length value to process.
+   *
+   * @return the US customary length phrase of the specified length value.
+   */
+  std::string GetUsCustomaryLength(float miles) const;
+
+ protected:
+  /**
+   * Renders the metric length phrase of the specified kilometer value.
+   */
+  std::string FormMetricLength(float kilometers) const;
+
+  /**
+   * Renders the US customary length phrase of the specified miles value.
+   */
+  std::string FormUsCustomaryLength(float miles) const;
+
+  /**
+   * Renders the metric length phrase of the specified rounded meters.
+   */
+  std::string FormMetersLength(int meters) const;
+
+  /**
+   * Renders the US customary length phrase of the specified rounded feet.
+   */
+  std::string FormFeetLength(int feet) const;
+
+  std::vector<std::string> metric_lengths_;
+  std::vector<std::string> us_customary_lengths_;
+  NumberFormatter number_formatter_;
+
+  // Rendered phrases indexed by tenths of a kilometer and by rounded meters
+  // divided by ten
+  std::vector<std::string> kilometer_phrases_;
+  std::vector<std::string> meter_phrases_;
+
+  // Rendered phrases indexed by tenths of a mile and by rounded feet
+  // divided by ten
+  std::vector<std::string> mile_phrases_;
+  std::vector<std::string> feet_phrases_;
+
+};
+
+}
+}
+
+#endif  // VALHALLA_ODIN_LENGTH_PHRASE_TABLE_H_
@@ -0,0 +1,171 @@
+#ifndef VALHALLA_ODIN_LOGGER_H_
+#define VALHALLA_ODIN_LOGGER_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <type_traits>
+
+#include <boost/property_tree/ptree.hpp>
+
+namespace valhalla {
+namespace odin {
+
+/**
+ * Logging of the request path. The level and the sample of the category are
+ * checked before anything is formatted so a filtered line costs two relaxed
+ * loads. Lines are formatted into a thread local buffer and written either
+ * directly or from a background thread.
+ */
+class Logger {
+ public:
+  enum Level : int {
+    kTrace = 0,
+    kDebug,
+    kInfo,
+    kWarn,
+    kError,
+    kOff
+  };
+
+  enum Category : size_t {
+    kRequest = 0,
+    kManeuvers,
+    kCache,
+    kStats,
+    kTraces,
+    kCategoryCount
+  };
+
+  using sink_t = std::function<void(Level, Category, const std::string&)>;
+
+  /**
+   * Sets up the logging from the odin.logging section of the config:
+   *   level       trace, debug, info, warn, error or off (info), any other
+   *               value logs a warning and falls back to info
+   *   async       write the lines from a background thread (false)
+   *   queue_size  lines the background thread holds before dropping (4096)
+   *   sample      one line in N is written for each category, for example
+   *               { "request": 100 } (1)
+   * Must be called before the workers start logging.
+   */
+  static void Configure(const boost::property_tree::ptree& config);
+
+  static void SetLevel(Level level);
+
+  /**
+   * Sets the sample rate of the specified category, one line in rate is
+   * written. A rate of 0 or 1 writes every line.
+   */
+  static void SetSampleRate(Category category, uint32_t rate);
+
+  /**
+   * Sets where the lines are written, the midgard logger if sink is empty.
+   * Must not be called while lines are being written.
+   */
+  static void SetSink(sink_t sink);
+
+  /**
+   * Starts or stops writing the lines from a background thread. Lines are
+   * dropped rather than blocking the request path when the queue is full.
+   * Must not be called while lines are being written.
+   */
+  static void SetAsync(bool async, size_t queue_size = kDefaultQueueSize);
+
+  /**
+   * Waits until the queued lines are written.
+   */
+  static void Flush();
+
+  /**
+   * Returns the number of lines dropped because the queue was full.
+   */
+  static uint64_t dropped();
+
+  /**
+   * Returns true if a line of the specified level and category should be
+   * written. Counts toward the sample of the category.
+   */
+  static bool IsEnabled(Level level, Category category) {
+    if (level < level_.load(std::memory_order_relaxed)) {
+      return false;
+    }
+    uint32_t rate = sample_rates_[category].load(std::memory_order_relaxed);
+    return (rate <= 1) || IsSampled(category, rate);
+  }
+
+  static void Write(Level level, Category category, const std::string& line);
+
+  static const char* GetLevelName(Level level);
+  static const char* GetCategoryName(Category category);
+
+ protected:
+  static constexpr size_t kDefaultQueueSize = 4096;
+
+  static bool IsSampled(Category category, uint32_t rate);
+
+  static std::atomic<int> level_;
+  static std::array<std::atomic<uint32_t>, kCategoryCount> sample_rates_;
+
+};
+
+/**
+ * A line being formatted, written when it goes out of scope. The line starts
+ * with the category and the fields follow as key=value pairs. The buffer is
+ * reused by the lines of a thread so formatting does not allocate.
+ */
+class LogLine {
+ public:
+  LogLine(Logger::Level level, Logger::Category category);
+  ~LogLine();
+
+  LogLine(const LogLine&) = delete;
+  LogLine& operator=(const LogLine&) = delete;
+
+  LogLine& Field(const char* key, const char* value);
+  LogLine& Field(const char* key, const std::string& value);
+  LogLine& Field(const char* key, double value);
+
+  template <class T>
+  typename std::enable_if<std::is_integral<T>::value, LogLine&>::type
+  Field(const char* key, T value) {
+    AppendKey(key);
+    if (std::is_signed<T>::value) {
+      AppendInteger(static_cast<int64_t>(value));
+    } else {
+      AppendInteger(static_cast<uint64_t>(value));
+    }
+    return *this;
+  }
+
+ protected:
+  void AppendKey(const char* key);
+  void AppendInteger(int64_t value);
+  void AppendInteger(uint64_t value);
+
+  Logger::Level level_;
+  Logger::Category category_;
+  std::string& line_;
+
+};
+
+}
+}
+
+/**
+ * Starts a line of the specified level and category, for example
+ *   ODIN_LOG(kInfo, kRequest).Field("id", id);
+ * Nothing after the macro is evaluated if the line is not written.
+ */
+#define ODIN_LOG(level, category)                                     \
+  if (!::valhalla::odin::Logger::IsEnabled(                           \
+          ::valhalla::odin::Logger::level,                            \
+          ::valhalla::odin::Logger::category)) {                      \
+  } else                                                              \
+    ::valhalla::odin::LogLine(::valhalla::odin::Logger::level,        \
+                              ::valhalla::odin::Logger::category)
+
+#endif  // VALHALLA_ODIN_LOGGER_H_
@@ -228,6 +228,7 @@ class Maneuver {
 
   const TransitStop& transit_connection_stop() const;
   void set_transit_connection_stop(const TransitStop& transit_connection_stop);
+  void set_transit_connection_stop(TransitStop&& transit_connection_stop);
 
   bool IsTransit() const;
 
@@ -238,7 +239,11 @@ class Maneuver {
 
   std::string GetTransitDepartureTime() const;
 
-  const std::list<TransitStop>& GetTransitStops() const;
+  int64_t GetTransitArrivalLocalTime() const;
+
+  int64_t GetTransitDepartureLocalTime() const;
+
+  const TransitStops& GetTransitStops() const;
 
   size_t GetTransitStopCount() const;
 
@@ -261,76 +266,71 @@ class Maneuver {
   void set_verbal_arrive_instruction(std::string&& verbal_arrive_instruction);
 
   const VerbalTextFormatter* verbal_formatter() const;
-  void set_verbal_formatter(
-      std::unique_ptr<VerbalTextFormatter>&& verbal_formatter);
+  void set_verbal_formatter(const VerbalTextFormatter* verbal_formatter);
+
+  // Clears the instructions so the maneuver can be narrated in another language
+  void ClearNarrative();
 
   std::string ToString() const;
 
   std::string ToParameterString() const;
 
  protected:
-  TripDirections_Maneuver_Type type_;
+  // The narrative, allocated once the maneuver is narrated
+  struct Narrative {
+    std::string instruction;
+    std::string verbal_transition_alert_instruction;
+    std::string verbal_pre_transition_instruction;
+    std::string verbal_post_transition_instruction;
+    std::string depart_instruction;
+    std::string verbal_depart_instruction;
+    std::string arrive_instruction;
+    std::string verbal_arrive_instruction;
+  };
+
+  // The transit attributes, allocated for transit and transit connections
+  struct Transit {
+    // The stop associated with the transit connection
+    TransitStop transit_connection_stop; // TODO determine how we want to handle in the future
+
+    // The transit route info including list of stops
+    TransitRouteInfo transit_info;
+  };
+
+  Narrative* mutable_narrative();
+  Transit* mutable_transit();
+
+  // The hot attributes of every maneuver are packed in place, the street
+  // names, signs, narrative and transit attributes are only allocated
+  // once they are set
   std::unique_ptr<StreetNames> street_names_;
   std::unique_ptr<StreetNames> begin_street_names_;
   std::unique_ptr<StreetNames> cross_street_names_;
-  std::string instruction_;
+  std::unique_ptr<Signs> signs_;
+  std::unique_ptr<Narrative> narrative_;
+  std::unique_ptr<Transit> transit_;
+  const VerbalTextFormatter* verbal_formatter_;
+
   float length_;     // Kilometers
   uint32_t time_;    // Seconds
   uint32_t basic_time_; // len/speed on each edge with no stop impact in seconds
   uint32_t turn_degree_;
-  RelativeDirection begin_relative_direction_;
-  TripDirections_Maneuver_CardinalDirection begin_cardinal_direction_;
   uint32_t begin_heading_;
   uint32_t end_heading_;
   uint32_t begin_node_index_;
   uint32_t end_node_index_;
   uint32_t begin_shape_index_;
   uint32_t end_shape_index_;
-  bool ramp_;
-  bool turn_channel_;
-  bool ferry_;
-  bool rail_ferry_;
-  bool roundabout_;
-  bool portions_toll_;
-  bool portions_unpaved_;
-  bool portions_highway_;
-  bool internal_intersection_;
-  Signs signs_;
   uint32_t internal_right_turn_count_;
   uint32_t internal_left_turn_count_;
   uint32_t roundabout_exit_count_;
-  bool fork_;
-  bool begin_intersecting_edge_name_consistency_;
-  bool intersecting_forward_edge_;
-  std::string verbal_transition_alert_instruction_;
-  std::string verbal_pre_transition_instruction_;
-  std::string verbal_post_transition_instruction_;
-  bool tee_;
-  bool unnamed_walkway_;
-  bool unnamed_cycleway_;
-  bool unnamed_mountain_bike_trail_;
-  bool verbal_multi_cue_;
-
-  ////////////////////////////////////////////////////////////////////////////
-  // Transit support
-
-  // Transit connection flag and the associated stop
-  bool transit_connection_;
-  TransitStop transit_connection_stop_; // TODO determine how we want to handle in the future
-
-  // The transit route info including list of stops
-  TransitRouteInfo transit_info_;
-
-  std::string depart_instruction_;
-  std::string verbal_depart_instruction_;
-  std::string arrive_instruction_;
-  std::string verbal_arrive_instruction_;
-  ////////////////////////////////////////////////////////////////////////////
+
+  TripDirections_Maneuver_Type type_;
+  RelativeDirection begin_relative_direction_;
+  TripDirections_Maneuver_CardinalDirection begin_cardinal_direction_;
 
   // Travel mode
   TripPath_TravelMode travel_mode_;
-  bool rail_;
-  bool bus_;
 
   // Travel types
   TripPath_VehicleType vehicle_type_;
@@ -338,7 +338,27 @@ class Maneuver {
   TripPath_BicycleType bicycle_type_;
   TripPath_TransitType transit_type_;
 
-  std::unique_ptr<VerbalTextFormatter> verbal_formatter_;
+  // Flags
+  bool ramp_ : 1;
+  bool turn_channel_ : 1;
+  bool ferry_ : 1;
+  bool rail_ferry_ : 1;
+  bool roundabout_ : 1;
+  bool portions_toll_ : 1;
+  bool portions_unpaved_ : 1;
+  bool portions_highway_ : 1;
+  bool internal_intersection_ : 1;
+  bool fork_ : 1;
+  bool begin_intersecting_edge_name_consistency_ : 1;
+  bool intersecting_forward_edge_ : 1;
+  bool tee_ : 1;
+  bool unnamed_walkway_ : 1;
+  bool unnamed_cycleway_ : 1;
+  bool unnamed_mountain_bike_trail_ : 1;
+  bool verbal_multi_cue_ : 1;
+  bool transit_connection_ : 1;
+  bool rail_ : 1;
+  bool bus_ : 1;
 
   // TODO notes
 
@@ -7,6 +7,8 @@
 #include <valhalla/proto/directions_options.pb.h>
 #include <valhalla/odin/enhancedtrippath.h>
 #include <valhalla/odin/maneuver.h>
+#include <valhalla/odin/stage_times.h>
+#include <valhalla/odin/trace_buffer.h>
 
 namespace valhalla {
 namespace odin {
@@ -24,13 +26,36 @@ class ManeuversBuilder {
    * @param directions_options The directions options such as: units and
    *                           language.
    * @param trip_path The trip path - list of nodes, edges, attributes and shape.
+   * @param trace The optional trace buffer that records the decisions.
    */
   ManeuversBuilder(const DirectionsOptions& directions_options,
-                   EnhancedTripPath* trip_path);
+                   EnhancedTripPath* trip_path, TraceBuffer* trace = nullptr);
 
-  std::list<Maneuver> Build();
+  /**
+   * Returns the maneuver list of the trip path.
+   *
+   * @param stage_times The optional stage times that the elapsed time of
+   *                    the produce and combine stages is added to.
+   */
+  std::list<Maneuver> Build(StageTimes* stage_times = nullptr);
 
  protected:
+  /**
+   * Returns the single travel mode of the edges of the trip path, or false
+   * if the trip path has several travel modes or transit connections and
+   * has to be produced with the mixed mode rules.
+   *
+   * @param travel_mode The travel mode of the edges if there is a single one.
+   */
+  bool GetSingleTravelMode(TripPath_TravelMode& travel_mode) const;
+
+  /**
+   * Produces the maneuvers of the trip path. The Mode selects the rules of
+   * the travel modes of the leg at compile time, the rules that can not
+   * apply to a single mode leg, such as transit and mode changes, are only
+   * compiled into the mixed mode.
+   */
+  template <class Mode>
   std::list<Maneuver> Produce();
 
   void Combine(std::list<Maneuver>& maneuvers);
@@ -65,14 +90,19 @@ class ManeuversBuilder {
 
   void CreateDestinationManeuver(Maneuver& maneuver);
 
+  template <class Mode>
   void CreateStartManeuver(Maneuver& maneuver);
 
+  template <class Mode>
   void InitializeManeuver(Maneuver& maneuver, int node_index);
 
+  template <class Mode>
   void UpdateManeuver(Maneuver& maneuver, int node_index);
 
+  template <class Mode>
   void FinalizeManeuver(Maneuver& maneuver, int node_index);
 
+  template <class Mode>
   void SetManeuverType(Maneuver& maneuver, bool none_type_allowed = true);
 
   void SetSimpleDirectionalManeuverType(Maneuver& maneuver,
@@ -82,6 +112,7 @@ class ManeuversBuilder {
   TripDirections_Maneuver_CardinalDirection DetermineCardinalDirection(
       uint32_t heading);
 
+  template <class Mode>
   bool CanManeuverIncludePrevEdge(Maneuver& maneuver, int node_index);
 
   bool IncludeUnnamedPrevEdge(int node_index, EnhancedTripPath_Edge* prev_edge,
@@ -146,8 +177,36 @@ class ManeuversBuilder {
    */
   void EnhanceSignlessInterchnages(std::list<Maneuver>& maneuvers);
 
+  /**
+   * Records the edges and the intersecting edges of the specified node
+   * into the trace.
+   *
+   * @param node_index The index of the node to trace.
+   */
+  void TraceNode(int node_index);
+
+  /**
+   * Records the specified maneuvers into the trace.
+   *
+   * @param maneuvers The list of maneuvers to trace.
+   * @param type The trace event type of the maneuvers.
+   */
+  void TraceManeuvers(const std::list<Maneuver>& maneuvers,
+                      TraceEvent::Type type);
+
+  /**
+   * Records the combine decision of the specified maneuvers into the trace.
+   *
+   * @param decision Why the maneuvers were or were not combined.
+   * @param curr_man The current maneuver.
+   * @param next_man The next maneuver.
+   */
+  void TraceCombine(TraceEvent::CombineDecision decision,
+                    const Maneuver& curr_man, const Maneuver& next_man);
+
   const DirectionsOptions& directions_options_;
   EnhancedTripPath* trip_path_;
+  TraceBuffer* trace_;
 
 };
 
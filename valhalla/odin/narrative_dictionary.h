@@ -8,6 +8,9 @@
 
 #include <boost/property_tree/ptree.hpp>
 
+#include <valhalla/odin/number_formatter.h>
+#include <valhalla/odin/length_phrase_table.h>
+
 namespace {
 
 // Subset keys
@@ -160,6 +163,7 @@ struct StartSubset : PhraseSet {
 struct StartVerbalSubset : StartSubset {
   std::vector<std::string> metric_lengths;
   std::vector<std::string> us_customary_lengths;
+  LengthPhraseTable length_phrases;
 };
 
 struct DestinationSubset : PhraseSet {
@@ -173,6 +177,7 @@ struct ContinueSubset : PhraseSet {
 struct ContinueVerbalSubset : ContinueSubset {
   std::vector<std::string> metric_lengths;
   std::vector<std::string> us_customary_lengths;
+  LengthPhraseTable length_phrases;
 };
 
 struct TurnSubset : PhraseSet {
@@ -212,6 +217,7 @@ struct TransitStopSubset : TransitSubset {
 struct PostTransitionVerbalSubset : PhraseSet {
   std::vector<std::string> metric_lengths;
   std::vector<std::string> us_customary_lengths;
+  LengthPhraseTable length_phrases;
   std::vector<std::string> empty_street_name_labels;
 };
 
@@ -357,6 +363,29 @@ class NarrativeDictionary {
    */
   const std::locale& GetLocale() const;
 
+  /**
+   * Returns the number formatter that uses the separators of the locale.
+   *
+   * @return the number formatter that uses the separators of the locale.
+   */
+  const NumberFormatter& GetNumberFormatter() const;
+
+  /**
+   * Returns the locale with a time_facet that writes the date.
+   *
+   * @return the locale with a time_facet that writes the date.
+   */
+  const std::locale& GetDateLocale() const;
+
+  /**
+   * Returns the localized time of the specified minute of the day.
+   *
+   * @param  minute_of_day  The minutes since midnight.
+   *
+   * @return the localized time of the specified minute of the day.
+   */
+  const std::string& GetLocalizedTime(uint32_t minute_of_day) const;
+
   /**
    * Returns the language tag of this dictionary.
    *
@@ -541,6 +570,15 @@ class NarrativeDictionary {
   // Locale
   std::locale locale;
 
+  // Number formatter for the locale
+  NumberFormatter number_formatter;
+
+  // Locale that formats dates
+  std::locale date_locale;
+
+  // Localized time of each minute of the day
+  std::vector<std::string> localized_times;
+
   // Language tag
   std::string language_tag;
 
@@ -2,6 +2,8 @@
 #define VALHALLA_ODIN_NARRATIVEBUILDER_H_
 
 #include <vector>
+#include <string>
+#include <initializer_list>
 
 #include <valhalla/baldr/verbal_text_formatter.h>
 
@@ -10,6 +12,7 @@
 #include <valhalla/odin/enhancedtrippath.h>
 #include <valhalla/odin/narrative_dictionary.h>
 #include <valhalla/odin/maneuver.h>
+#include <valhalla/odin/instruction_cache.h>
 
 namespace valhalla {
 namespace odin {
@@ -389,36 +392,34 @@ class NarrativeBuilder {
 
 
   /////////////////////////////////////////////////////////////////////////////
-  /**
-   * Returns the length string of the specified maneuver.
-   *
-   * @param maneuver The maneuver to process.
-   *
-   * @return the length string of the specified maneuver.
-   */
-  std::string FormLength(Maneuver& maneuver,
-                         const std::vector<std::string>& metric_lengths,
-                         const std::vector<std::string>& us_customary_lengths);
+  // A phrase tag and the value that replaces it
+  using PhraseTag = InstructionCache::PhraseTag;
 
   /**
-   * Returns the metric length string of the specified kilometer value.
+   * Returns the specified phrase of the subset with its tags replaced by
+   * their values. The rendered phrase is shared through the instruction
+   * cache when the cache is enabled.
    *
-   * @param kilometers The length value to process.
+   * @param subset The phrase subset of the dictionary.
+   * @param phrase_id The identifier of the tagged phrase.
+   * @param phrase_tags The phrase tags and their values.
    *
-   * @return the metric length string of the specified length value.
+   * @return the phrase with its tags replaced by their values.
    */
-  std::string FormMetricLength(float kilometers,
-                               const std::vector<std::string>& metric_lengths);
+  std::string FormPhrase(const PhraseSet& subset, uint8_t phrase_id,
+                         std::initializer_list<PhraseTag> phrase_tags);
 
+  /////////////////////////////////////////////////////////////////////////////
   /**
-   * Returns the US customary length string of the specified miles value.
+   * Returns the length string of the specified maneuver.
    *
-   * @param miles The length value to process.
+   * @param maneuver The maneuver to process.
+   * @param length_phrases The precomputed length phrases of the subset.
    *
-   * @return the US customary length string of the specified length value.
+   * @return the length string of the specified maneuver.
    */
-  std::string FormUsCustomaryLength(float miles,
-      const std::vector<std::string>& us_customary_lengths);
+  std::string FormLength(Maneuver& maneuver,
+                         const LengthPhraseTable& length_phrases);
 
   /////////////////////////////////////////////////////////////////////////////
   std::string FormRelativeTwoDirection(
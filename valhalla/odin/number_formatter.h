@@ -0,0 +1,91 @@
+#ifndef VALHALLA_ODIN_NUMBER_FORMATTER_H_
+#define VALHALLA_ODIN_NUMBER_FORMATTER_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <locale>
+
+namespace valhalla {
+namespace odin {
+
+/**
+ * Formats numbers the same way a std::stringstream imbued with a locale
+ * would, without constructing a stream for every value. The decimal point,
+ * thousands separator and grouping are captured from the locale once.
+ */
+class NumberFormatter {
+ public:
+  /**
+   * Constructor that uses the separators of the classic "C" locale.
+   */
+  NumberFormatter();
+
+  /**
+   * Constructor that captures the separators of the specified locale.
+   *
+   * @param  locale  The locale whose numpunct facet defines the separators.
+   */
+  explicit NumberFormatter(const std::locale& locale);
+
+  /**
+   * Writes the specified value with a fixed number of decimal places into
+   * the specified buffer. The buffer is not null terminated.
+   *
+   * @param  value  The value to format.
+   * @param  precision  The number of decimal places to write.
+   * @param  buffer  The output buffer.
+   * @param  size  The size of the output buffer.
+   * @return the number of characters written or 0 if the buffer is too small.
+   */
+  size_t Format(double value, uint32_t precision, char* buffer,
+                size_t size) const;
+
+  /**
+   * Writes the specified integer value into the specified buffer.
+   * The buffer is not null terminated.
+   *
+   * @param  value  The value to format.
+   * @param  buffer  The output buffer.
+   * @param  size  The size of the output buffer.
+   * @return the number of characters written or 0 if the buffer is too small.
+   */
+  size_t Format(int value, char* buffer, size_t size) const;
+
+  /**
+   * Returns the specified value formatted with a fixed number of decimal
+   * places.
+   *
+   * @param  value  The value to format.
+   * @param  precision  The number of decimal places.
+   * @return the formatted value.
+   */
+  std::string Format(double value, uint32_t precision) const;
+
+  /**
+   * Returns the specified integer value formatted.
+   *
+   * @param  value  The value to format.
+   * @return the formatted value.
+   */
+  std::string Format(int value) const;
+
+ protected:
+  /**
+   * Writes the sign and the grouped integer digits into the specified buffer.
+   *
+   * @return the number of characters written or 0 if the buffer is too small.
+   */
+  size_t FormatIntegerPart(const char* digits, size_t digit_count,
+                           bool negative, char* buffer, size_t size) const;
+
+  char decimal_point_;
+  char thousands_sep_;
+  std::string grouping_;
+
+};
+
+}
+}
+
+#endif  // VALHALLA_ODIN_NUMBER_FORMATTER_H_
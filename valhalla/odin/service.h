@@ -1,9 +1,21 @@
 #ifndef __VALHALLA_ODIN_SERVICE_H__
 #define __VALHALLA_ODIN_SERVICE_H__
 
+#include <string>
+#include <memory>
+#include <vector>
+
 #include <boost/property_tree/ptree.hpp>
 #include <prime_server/prime_server.hpp>
 
+#include <valhalla/odin/directions_batch.h>
+#include <valhalla/odin/directions_cache.h>
+#include <valhalla/odin/duplicate_legs.h>
+#include <valhalla/odin/job_capture.h>
+#include <valhalla/odin/worker_stats.h>
+#include <valhalla/odin/trace_buffer.h>
+#include <valhalla/odin/trace_files.h>
+
 
 namespace valhalla {
   namespace odin {
@@ -21,6 +33,18 @@ namespace valhalla {
 
       boost::property_tree::ptree config;
       boost::optional<std::string> jsonp;
+      DirectionsCache directions_cache;
+      WorkerStats stats;
+      uint32_t stats_interval;
+      std::unique_ptr<TraceFiles> trace_files;
+      bool trace_requests;
+      size_t trace_events;
+      uint32_t trace_sample_rate;
+      uint64_t trace_sample_count;
+      std::vector<std::unique_ptr<TraceBuffer>> trace_buffers;
+      DirectionsBatch batch;
+      DuplicateLegs duplicate_legs;
+      std::unique_ptr<JobCapture> capture;
     };
   }
 }
@@ -0,0 +1,170 @@
+#ifndef VALHALLA_ODIN_SHARED_TRIP_PATHS_H_
+#define VALHALLA_ODIN_SHARED_TRIP_PATHS_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace valhalla {
+namespace odin {
+
+/**
+ * Ring of serialized trip paths in POSIX shared memory, written by the
+ * process computing the routes. Instead of the trip path bytes the upstream
+ * sends a small handle frame that odin resolves with SharedTripPath::Open and
+ * parses in place. A record is reused once odin has released it.
+ *
+ * There must be a single writer per ring. The ring is removed when its
+ * writer is destroyed.
+ */
+class SharedTripPathRing {
+ public:
+  /**
+   * Creates the shared memory ring.
+   * Throws std::runtime_error if it cannot be created.
+   *
+   * @param  name      The shared memory name, for example /odin_trip_paths.
+   * @param  capacity  The number of bytes available to the records.
+   */
+  SharedTripPathRing(const std::string& name, size_t capacity);
+
+  ~SharedTripPathRing();
+
+  SharedTripPathRing(const SharedTripPathRing&) = delete;
+  SharedTripPathRing& operator=(const SharedTripPathRing&) = delete;
+
+  /**
+   * Copies a serialized trip path into the ring.
+   *
+   * @param  trip_path  The serialized trip path.
+   * @param  size       The size of the serialized trip path.
+   * @param  handle     The handle frame to send in place of the trip path.
+   * @return false if the ring has no room for the trip path until odin
+   *         releases some, the caller may then send the bytes themselves.
+   */
+  bool Write(const char* trip_path, size_t size, std::string& handle);
+
+  /**
+   * Returns the number of bytes taken by records odin has not released.
+   */
+  size_t used();
+
+  const std::string& name() const;
+  size_t capacity() const;
+
+ protected:
+  // Reuses the space of the released records, oldest first
+  void Reclaim();
+
+  std::string name_;
+  size_t capacity_;
+  char* mapping_;
+  size_t mapping_size_;
+  size_t head_;
+  size_t tail_;
+  size_t used_;
+  uint64_t sequence_;
+  uint64_t ring_id_;
+
+};
+
+/**
+ * A trip path of a shared memory ring, released when destroyed.
+ */
+class SharedTripPath {
+ public:
+  /**
+   * Returns true if the specified frame is a handle rather than a serialized
+   * trip path, which can never start with the handle magic.
+   */
+  static bool IsHandle(const char* frame, size_t size);
+
+  /**
+   * Returns the trip path of the specified handle frame. The ring is mapped
+   * on first use and stays mapped until it is recreated under the same name
+   * and none of its trip paths is open any more. The record is claimed so a
+   * handle can only be opened once.
+   * Throws std::runtime_error if the ring or the record cannot be found or
+   * the record is already opened.
+   */
+  static SharedTripPath Open(const char* frame, size_t size);
+
+  SharedTripPath(SharedTripPath&& other);
+  SharedTripPath& operator=(SharedTripPath&& other);
+  ~SharedTripPath();
+
+  SharedTripPath(const SharedTripPath&) = delete;
+  SharedTripPath& operator=(const SharedTripPath&) = delete;
+
+  const char* data() const;
+  size_t size() const;
+
+  /**
+   * Lets the writer reuse the record, data() is no longer valid.
+   */
+  void Release();
+
+ protected:
+  SharedTripPath(char* mapping, char* record, size_t size);
+
+  // The start of the mapping of the ring, which is kept open by the record
+  char* mapping_;
+  char* record_;
+  size_t size_;
+
+};
+
+/**
+ * The trip path frames of a job with their handle frames resolved. Every
+ * handle of the job is opened as it is added, even after one of them fails,
+ * and all of them are released when this is destroyed. A record that is never
+ * released blocks the ring for good so the job must not return early between
+ * receiving the frames and adding them.
+ */
+class TripPathFrames {
+ public:
+  TripPathFrames();
+
+  /**
+   * Adds a frame, a handle frame is opened right away.
+   */
+  void Add(const char* frame, size_t size);
+
+  /**
+   * Returns false if a handle frame could not be opened.
+   */
+  bool opened() const;
+
+  size_t size() const;
+
+  /**
+   * Returns the serialized trip path of the specified frame, which is null
+   * for a handle that could not be opened or that was released.
+   */
+  const char* data(size_t index) const;
+  size_t size(size_t index) const;
+
+  /**
+   * Lets the writer reuse the records of all the handle frames.
+   */
+  void Release();
+
+ protected:
+  struct frame_t {
+    const char* data;
+    size_t size;
+    const char* trip_path;
+    size_t trip_path_size;
+  };
+
+  std::vector<frame_t> frames_;
+  std::vector<SharedTripPath> trip_paths_;
+  bool opened_;
+
+};
+
+}
+}
+
+#endif  // VALHALLA_ODIN_SHARED_TRIP_PATHS_H_
@@ -0,0 +1,143 @@
+#ifndef VALHALLA_ODIN_SIGN_LIST_H_
+#define VALHALLA_ODIN_SIGN_LIST_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <valhalla/odin/sign.h>
+
+namespace valhalla {
+namespace odin {
+
+/**
+ * The signs of one exit list. Most exits have one or two signs per list so
+ * they are stored in place and only a longer list is moved to the heap. It
+ * supports the operations of the std::vector<Sign> it replaces that the
+ * callers use, the signs are contiguous so the iterators are pointers.
+ */
+class SignList {
+ public:
+  using value_type = Sign;
+  using size_type = size_t;
+  using reference = Sign&;
+  using const_reference = const Sign&;
+  using iterator = Sign*;
+  using const_iterator = const Sign*;
+
+  SignList();
+  SignList(const SignList& other);
+  SignList(SignList&& other);
+  ~SignList();
+
+  SignList& operator =(const SignList& other);
+  SignList& operator =(SignList&& other);
+
+  template <class... Args>
+  void emplace_back(Args&&... args) {
+    if (size_ < capacity_) {
+      new (data_ + size_) Sign(std::forward<Args>(args)...);
+    } else {
+      // The arguments may refer to a sign of this list
+      Sign sign(std::forward<Args>(args)...);
+      Reserve(capacity_ * 2);
+      new (data_ + size_) Sign(std::move(sign));
+    }
+    ++size_;
+  }
+
+  void push_back(const Sign& sign) {
+    emplace_back(sign);
+  }
+
+  void push_back(Sign&& sign) {
+    emplace_back(std::move(sign));
+  }
+
+  iterator begin() {
+    return data_;
+  }
+
+  iterator end() {
+    return data_ + size_;
+  }
+
+  const_iterator begin() const {
+    return data_;
+  }
+
+  const_iterator end() const {
+    return data_ + size_;
+  }
+
+  Sign& operator [](size_t index) {
+    return data_[index];
+  }
+
+  const Sign& operator [](size_t index) const {
+    return data_[index];
+  }
+
+  // Throws std::out_of_range if the index is not in the list
+  Sign& at(size_t index);
+  const Sign& at(size_t index) const;
+
+  Sign& front() {
+    return data_[0];
+  }
+
+  const Sign& front() const {
+    return data_[0];
+  }
+
+  Sign& back() {
+    return data_[size_ - 1];
+  }
+
+  const Sign& back() const {
+    return data_[size_ - 1];
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  bool empty() const {
+    return (size_ == 0);
+  }
+
+  size_t capacity() const {
+    return capacity_;
+  }
+
+  void clear();
+
+  bool operator ==(const SignList& rhs) const;
+  bool operator !=(const SignList& rhs) const;
+
+ protected:
+  static constexpr uint32_t kInlineCapacity = 2;
+
+  Sign* InlineData();
+  bool IsInline() const;
+
+  // Moves the signs to a heap buffer of the specified capacity
+  void Reserve(uint32_t capacity);
+
+  // Moves the signs of the other list and leaves it empty
+  void MoveFrom(SignList& other);
+
+  Sign* data_;
+  uint32_t size_;
+  uint32_t capacity_;
+  typename std::aligned_storage<sizeof(Sign), alignof(Sign)>::type
+      inline_signs_[kInlineCapacity];
+
+};
+
+}
+}
+
+#endif  // VALHALLA_ODIN_SIGN_LIST_H_
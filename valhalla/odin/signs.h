@@ -1,12 +1,13 @@
 #ifndef VALHALLA_ODIN_SIGNS_H_
 #define VALHALLA_ODIN_SIGNS_H_
 
-#include <vector>
+#include <string>
 
 #include <valhalla/baldr/verbal_text_formatter.h>
 #include <valhalla/baldr/verbal_text_formatter_us.h>
 
 #include <valhalla/odin/sign.h>
+#include <valhalla/odin/sign_list.h>
 
 using namespace valhalla::baldr;
 
@@ -19,32 +20,32 @@ class Signs {
  public:
   Signs();
 
-  const std::vector<Sign>& exit_number_list() const;
-  std::vector<Sign>* mutable_exit_number_list();
+  const SignList& exit_number_list() const;
+  SignList* mutable_exit_number_list();
 
   const std::string GetExitNumberString(
       uint32_t max_count = 0, bool limit_by_consecutive_count = false,
       std::string delim = "/",
       const VerbalTextFormatter* verbal_formatter = nullptr) const;
 
-  const std::vector<Sign>& exit_branch_list() const;
-  std::vector<Sign>* mutable_exit_branch_list();
+  const SignList& exit_branch_list() const;
+  SignList* mutable_exit_branch_list();
 
   const std::string GetExitBranchString(
       uint32_t max_count = 0, bool limit_by_consecutive_count = false,
       std::string delim = "/",
       const VerbalTextFormatter* verbal_formatter = nullptr) const;
 
-  const std::vector<Sign>& exit_toward_list() const;
-  std::vector<Sign>* mutable_exit_toward_list();
+  const SignList& exit_toward_list() const;
+  SignList* mutable_exit_toward_list();
 
   const std::string GetExitTowardString(
       uint32_t max_count = 0, bool limit_by_consecutive_count = false,
       std::string delim = "/",
       const VerbalTextFormatter* verbal_formatter = nullptr) const;
 
-  const std::vector<Sign>& exit_name_list() const;
-  std::vector<Sign>* mutable_exit_name_list();
+  const SignList& exit_name_list() const;
+  SignList* mutable_exit_name_list();
 
   const std::string GetExitNameString(
       uint32_t max_count = 0, bool limit_by_consecutive_count = false,
@@ -64,18 +65,18 @@ class Signs {
   bool operator ==(const Signs& rhs) const;
 
  protected:
-  const std::string ListToString(const std::vector<Sign>& signs,
+  const std::string ListToString(const SignList& signs,
                                  uint32_t max_count = 0,
                                  bool limit_by_consecutive_count = false,
                                  std::string delim = "/",
                                  const VerbalTextFormatter* verbal_formatter = nullptr) const;
 
-  const std::string ListToParameterString(const std::vector<Sign>& signs) const;
+  const std::string ListToParameterString(const SignList& signs) const;
 
-  std::vector<Sign> exit_number_list_;
-  std::vector<Sign> exit_branch_list_;
-  std::vector<Sign> exit_toward_list_;
-  std::vector<Sign> exit_name_list_;
+  SignList exit_number_list_;
+  SignList exit_branch_list_;
+  SignList exit_toward_list_;
+  SignList exit_name_list_;
 
 };
 
@@ -0,0 +1,81 @@
+#ifndef VALHALLA_ODIN_STAGE_TIMES_H_
+#define VALHALLA_ODIN_STAGE_TIMES_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <chrono>
+
+namespace valhalla {
+namespace odin {
+
+/**
+ * Elapsed time of each stage of building the directions of a trip path.
+ * The builders only time their stages when they are given stage times.
+ */
+class StageTimes {
+ public:
+  enum Stage {
+    kUpdateHeading = 0,
+    kProduce,
+    kCombine,
+    kNarrative,
+    kPopulate,
+    kStageCount
+  };
+
+  StageTimes();
+
+  /**
+   * Returns the name of the specified stage.
+   *
+   * @param  stage  The stage.
+   * @return the name of the stage.
+   */
+  static const char* GetStageName(Stage stage);
+
+  /**
+   * Adds the specified elapsed time to the stage.
+   *
+   * @param  stage  The stage.
+   * @param  nanoseconds  The elapsed time of the stage.
+   */
+  void Add(Stage stage, uint64_t nanoseconds);
+
+  uint64_t Get(Stage stage) const;
+
+  uint64_t GetTotal() const;
+
+  void Clear();
+
+ protected:
+  std::array<uint64_t, kStageCount> nanoseconds_;
+
+};
+
+/**
+ * Adds the time between its construction and destruction to a stage.
+ * Nothing is timed when the stage times are null.
+ */
+class ScopedStageTimer {
+ public:
+  ScopedStageTimer(StageTimes* stage_times, StageTimes::Stage stage);
+
+  ~ScopedStageTimer();
+
+  ScopedStageTimer(const ScopedStageTimer&) = delete;
+  ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+
+ protected:
+  using clock_t = std::chrono::steady_clock;
+
+  StageTimes* stage_times_;
+  StageTimes::Stage stage_;
+  clock_t::time_point start_;
+
+};
+
+}
+}
+
+#endif  // VALHALLA_ODIN_STAGE_TIMES_H_
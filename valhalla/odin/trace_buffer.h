@@ -0,0 +1,115 @@
+#ifndef VALHALLA_ODIN_TRACE_BUFFER_H_
+#define VALHALLA_ODIN_TRACE_BUFFER_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace valhalla {
+namespace odin {
+
+/**
+ * Fixed size binary record of a decision made while building maneuvers.
+ */
+struct TraceEvent {
+  enum Type : uint16_t {
+    kNone = 0,
+    kNode,              // values: turn degree, xedge count, begin/end heading
+    kIntersectingEdge,  // code: xedge index, values: heading, turn degree,
+                        // driveability, walkability
+    kRightXEdgeCounts,  // values: all, similar, traversable outbound,
+                        // similar traversable outbound
+    kLeftXEdgeCounts,   // values: same as the right counts
+    kManeuverUpdate,    // the previous edge of the node extends the maneuver
+    kManeuverBegin,     // the node ends a maneuver and begins a new one
+    kCombine,           // code: combine decision, values: next begin node
+    kManeuver,          // code: maneuver type, values: end node, length in
+                        // meters, street name count, turn degree
+    kCombinedManeuver,  // values: same as the maneuver
+    kTypeCount
+  };
+
+  // Why two consecutive maneuvers were or were not combined
+  enum CombineDecision : uint16_t {
+    kCollapseTransitConnectionStart = 0,
+    kCollapseTransitConnectionDestination,
+    kNoCombineTransitConnection,
+    kNoCombineTravelModeOrDestination,
+    kNoCombineForkOrTee,
+    kNoCombineFerry,
+    kCombineInternal,
+    kCombineTurnChannel,
+    kNoCombineIntersectingForwardEdge,
+    kNoCombineTravelType,
+    kCombineSameNameStraight,
+    kCombineUnnamedStraight,
+    kNoCombine,
+    kCombineDecisionCount
+  };
+
+  uint16_t type;
+  uint16_t code;
+  uint32_t node_index;
+  int32_t values[4];
+};
+
+/**
+ * Ring buffer of the trace events of a request. The oldest events are
+ * overwritten once the buffer is full. The builders only record events when
+ * they are given a trace buffer so tracing costs nothing when it is off.
+ */
+class TraceBuffer {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param  capacity  The maximum number of kept events.
+   */
+  explicit TraceBuffer(size_t capacity = kDefaultCapacity);
+
+  void Add(TraceEvent::Type type, uint16_t code, uint32_t node_index,
+           int32_t value0 = 0, int32_t value1 = 0, int32_t value2 = 0,
+           int32_t value3 = 0);
+
+  /**
+   * Returns the kept events, oldest first.
+   */
+  std::vector<TraceEvent> GetEvents() const;
+
+  /**
+   * Returns the binary form of the kept events that Deserialize decodes.
+   */
+  std::string Serialize() const;
+
+  /**
+   * Returns the events of the specified binary trace.
+   * Throws std::runtime_error if the trace is not valid.
+   *
+   * @param  trace  The binary trace.
+   * @return the events, oldest first.
+   */
+  static std::vector<TraceEvent> Deserialize(const std::string& trace);
+
+  /**
+   * Returns a readable line describing the specified event.
+   */
+  static std::string ToString(const TraceEvent& event);
+
+  size_t capacity() const;
+  size_t size() const;
+  uint64_t dropped() const;
+  void clear();
+
+ protected:
+  static constexpr size_t kDefaultCapacity = 1 << 16;
+
+  std::vector<TraceEvent> events_;
+  uint64_t count_;
+
+};
+
+}
+}
+
+#endif  // VALHALLA_ODIN_TRACE_BUFFER_H_
@@ -0,0 +1,57 @@
+#ifndef VALHALLA_ODIN_TRACE_FILES_H_
+#define VALHALLA_ODIN_TRACE_FILES_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <list>
+#include <string>
+
+#include <valhalla/odin/trace_buffer.h>
+
+namespace valhalla {
+namespace odin {
+
+/**
+ * Writes the traces of a worker for odin_trace_decode, one file per leg,
+ * named after the process, the worker, the request and the leg. The oldest
+ * files of the worker are removed so at most max_files are kept, each of them
+ * bounded by the capacity of its trace buffer. The bound only applies to the
+ * files written by the worker during the life of the process, the files of
+ * earlier processes are left in the directory.
+ */
+class TraceFiles {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param  directory  The directory the trace files are written to.
+   * @param  max_files  The number of files kept, 0 keeps every file.
+   */
+  TraceFiles(const std::string& directory, size_t max_files);
+
+  /**
+   * Writes the trace of a leg of a request to a new file, replacing the
+   * file of the same leg of the request if the worker traced it before.
+   * Throws std::runtime_error if the file cannot be written.
+   *
+   * @param  id         The id of the request.
+   * @param  leg_index  The index of the leg in the request.
+   * @param  trace      The trace of the leg.
+   * @return the name of the file.
+   */
+  std::string Write(uint64_t id, size_t leg_index, const TraceBuffer& trace);
+
+  const std::string& directory() const;
+
+ protected:
+  std::string directory_;
+  size_t max_files_;
+  uint32_t worker_;
+  std::list<std::string> file_names_;
+
+};
+
+}
+}
+
+#endif  // VALHALLA_ODIN_TRACE_FILES_H_
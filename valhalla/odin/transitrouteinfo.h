@@ -1,8 +1,10 @@
 #ifndef VALHALLA_ODIN_TRANSIT_ROUTE_INFO_H_
 #define VALHALLA_ODIN_TRANSIT_ROUTE_INFO_H_
 
+#include <cstddef>
 #include <string>
-#include <list>
+#include <vector>
+#include <utility>
 
 #include <valhalla/proto/trippath.pb.h>
 #include <valhalla/odin/transitstop.h>
@@ -10,6 +12,58 @@
 namespace valhalla {
 namespace odin {
 
+/**
+ * The stops of a transit route in one contiguous table. Maneuvers are built
+ * from the end of the trip path to its beginning so stops are added in front
+ * of the others. They are stored last to first and iterated in route order.
+ */
+class TransitStops {
+ public:
+  using iterator = std::vector<TransitStop>::reverse_iterator;
+  using const_iterator = std::vector<TransitStop>::const_reverse_iterator;
+
+  void push_front(TransitStop&& transit_stop) {
+    stops_.push_back(std::move(transit_stop));
+  }
+
+  const TransitStop& front() const {
+    return stops_.back();
+  }
+
+  const TransitStop& back() const {
+    return stops_.front();
+  }
+
+  iterator begin() {
+    return stops_.rbegin();
+  }
+
+  iterator end() {
+    return stops_.rend();
+  }
+
+  const_iterator begin() const {
+    return stops_.crbegin();
+  }
+
+  const_iterator end() const {
+    return stops_.crend();
+  }
+
+  size_t size() const {
+    return stops_.size();
+  }
+
+  bool empty() const {
+    return stops_.empty();
+  }
+
+ protected:
+  // Last stop first
+  std::vector<TransitStop> stops_;
+
+};
+
 // TODO maybe rename later
 struct TransitRouteInfo {
 
@@ -27,7 +81,7 @@ struct TransitRouteInfo {
   std::string operator_onestop_id;
   std::string operator_name;
   std::string operator_url;
-  std::list<TransitStop> transit_stops;
+  TransitStops transit_stops;
 
 };
 
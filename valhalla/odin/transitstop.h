@@ -1,6 +1,7 @@
 #ifndef VALHALLA_ODIN_TRANSIT_STOP_H_
 #define VALHALLA_ODIN_TRANSIT_STOP_H_
 
+#include <cstdint>
 #include <string>
 
 #include <valhalla/proto/trippath.pb.h>
@@ -9,8 +10,14 @@
 namespace valhalla {
 namespace odin {
 
+// Local time of a stop without a valid arrival or departure date time
+constexpr int64_t kInvalidTransitTime = -1;
+
 struct TransitStop {
 
+  // An unnamed stop without date times
+  TransitStop();
+
   TransitStop(TripDirections_TransitStop_Type type, std::string onestop_id,
               std::string name, std::string arrival_date_time,
               std::string departure_date_time, bool is_parent_stop,
@@ -21,6 +28,9 @@ struct TransitStop {
               std::string departure_date_time, bool is_parent_stop,
               bool assumed_schedule, float lat, float lng);
 
+  // The stop of a trip path node, its strings are copied straight in place
+  explicit TransitStop(const TripPath_TransitStopInfo& stop_info);
+
   std::string ToParameterString() const;
 
   TripDirections_TransitStop_Type type;
@@ -30,7 +40,19 @@ struct TransitStop {
   std::string departure_date_time;
   bool is_parent_stop;
   bool assumed_schedule;
-  TripDirections_LatLng ll;
+  float lat;
+  float lng;
+
+  // Date times parsed once when the stop is created. Local times are in
+  // seconds since the epoch and tz offsets are in minutes.
+  int64_t arrival_local_time;
+  int64_t departure_local_time;
+  int16_t arrival_tz_offset;
+  int16_t departure_tz_offset;
+
+ protected:
+  // Parses the date times into the local times and tz offsets
+  void ParseDateTimes();
 };
 
 }
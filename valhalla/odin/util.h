@@ -5,11 +5,15 @@
 #include <string>
 #include <unordered_map>
 #include <locale>
+#include <memory>
 
 #include <boost/property_tree/ptree.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <valhalla/baldr/verbal_text_formatter.h>
 #include <valhalla/proto/directions_options.pb.h>
 #include <valhalla/odin/narrative_dictionary.h>
+#include <valhalla/odin/instruction_cache.h>
 
 namespace valhalla {
 namespace odin {
@@ -27,6 +31,45 @@ bool IsSimilarTurnDegree(uint32_t path_turn_degree,
 
 DirectionsOptions GetDirectionsOptions(const boost::property_tree::ptree& pt);
 
+/**
+ * Parse the date and time from the inputed date. The tz offset is not used
+ * and an hour of 24 is the start of the following day.
+ * @param   date_time in the format of 2015-05-06T08:00-05:00
+ * @param   pt  the parsed date and time
+ * @return  Returns true if the date and time were parsed.
+ */
+bool parse_date_time(const std::string& date_time,
+                     boost::posix_time::ptime& pt);
+
+/**
+ * Parse the inputed date into the local time in seconds since the epoch and
+ * the tz offset. A missing or malformed tz offset is treated as UTC.
+ * @param   date_time in the format of 2015-05-06T08:00-05:00
+ * @param   local_time  the local date and time in seconds since the epoch
+ * @param   tz_offset  the tz offset in minutes
+ * @return  Returns true if the date and time were parsed.
+ */
+bool parse_date_time(const std::string& date_time, int64_t& local_time,
+                     int16_t& tz_offset);
+
+/**
+ * Format the time of the specified date and time.
+ * @param   pt  the date and time
+ * @param   time_locale  locale with a time_facet that writes "%X"
+ * @return  Returns the formated time based on the locale.
+ */
+std::string format_localized_time(const boost::posix_time::ptime& pt,
+                                  const std::locale& time_locale);
+
+/**
+ * Format the date of the specified date and time.
+ * @param   pt  the date and time
+ * @param   date_locale  locale with a time_facet that writes "%x"
+ * @return  Returns the formated date based on the locale.
+ */
+std::string format_localized_date(const boost::posix_time::ptime& pt,
+                                  const std::locale& date_locale);
+
 /**
  * Get the time from the inputed date.
  * date_time is in the format of 2015-05-06T08:00
@@ -37,6 +80,27 @@ DirectionsOptions GetDirectionsOptions(const boost::property_tree::ptree& pt);
 std::string get_localized_time(const std::string& date_time,
                                const std::locale& locale);
 
+/**
+ * Get the time from the inputed date using the times that were formatted
+ * when the dictionary was loaded.
+ * @param   date_time in the format of 2015-05-06T08:00
+ * @param   dictionary
+ * @return  Returns the formated time based on the locale of the dictionary.
+ */
+std::string get_localized_time(const std::string& date_time,
+                               const NarrativeDictionary& dictionary);
+
+/**
+ * Get the time from a local time using the times that were formatted when
+ * the dictionary was loaded.
+ * @param   local_time  the local date and time in seconds since the epoch
+ * @param   dictionary
+ * @return  Returns the formated time based on the locale of the dictionary
+ *          or an empty string if the local time is negative.
+ */
+std::string get_localized_time(int64_t local_time,
+                               const NarrativeDictionary& dictionary);
+
 /**
  * Get the date from the inputed date.
  * date_time is in the format of 2015-05-06T08:00
@@ -47,6 +111,15 @@ std::string get_localized_time(const std::string& date_time,
 std::string get_localized_date(const std::string& date_time,
                                const std::locale& locale);
 
+/**
+ * Get the date from the inputed date using the date facet of the dictionary.
+ * @param   date_time in the format of 2015-05-06T08:00
+ * @param   dictionary
+ * @return  Returns the formated date based on the locale of the dictionary.
+ */
+std::string get_localized_date(const std::string& date_time,
+                               const NarrativeDictionary& dictionary);
+
 /**
  * Returns locale strings mapped to NarrativeDictionaries containing parsed narrative information
  *
@@ -55,6 +128,26 @@ std::string get_localized_date(const std::string& date_time,
 using locales_singleton_t = std::unordered_map<std::string, std::shared_ptr<NarrativeDictionary> >;
 const locales_singleton_t& get_locales();
 
+/**
+ * Returns the verbal text formatter of the specified country and state.
+ * Formatters are immutable and created once per process for each
+ * country and state, so the returned pointer stays valid.
+ *
+ * @param  country_code  the country code of the admin
+ * @param  state_code  the state code of the admin
+ * @return the verbal text formatter of the country and state
+ */
+const baldr::VerbalTextFormatter* get_verbal_text_formatter(
+    const std::string& country_code, const std::string& state_code);
+
+/**
+ * Returns the cache of rendered instructions shared by the whole process.
+ * The cache is disabled until its maximum number of entries is set.
+ *
+ * @return the instruction cache
+ */
+InstructionCache& get_instruction_cache();
+
 /**
  * Returns locale strings mapped to json strings defining the dictionaries
  *
@@ -0,0 +1,157 @@
+#ifndef VALHALLA_ODIN_WORKER_STATS_H_
+#define VALHALLA_ODIN_WORKER_STATS_H_
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <array>
+#include <vector>
+#include <atomic>
+
+#include <valhalla/odin/stage_times.h>
+
+namespace valhalla {
+namespace odin {
+
+/**
+ * Latency histogram with 4 logarithmic buckets per power of two nanoseconds.
+ * Only its owner thread records into it while any thread can read it.
+ */
+class LatencyHistogram {
+ public:
+  // Latencies below 2^41 nanoseconds (~36 minutes) have their own bucket
+  static constexpr size_t kBucketCount = 40 * 4;
+
+  using counts_t = std::array<uint64_t, kBucketCount>;
+
+  LatencyHistogram();
+
+  /**
+   * Records the specified latency. Must only be called by the owner thread.
+   *
+   * @param  nanoseconds  The latency.
+   */
+  void Record(uint64_t nanoseconds);
+
+  /**
+   * Adds the bucket counts and the latency sum of this histogram to the
+   * specified counts and sum.
+   *
+   * @param  counts  The bucket counts to add to.
+   * @param  sum  The latency sum to add to.
+   */
+  void AddTo(counts_t& counts, uint64_t& sum) const;
+
+  /**
+   * Returns the bucket of the specified latency.
+   *
+   * @param  nanoseconds  The latency.
+   * @return the bucket index.
+   */
+  static size_t GetBucket(uint64_t nanoseconds);
+
+  /**
+   * Returns the largest latency of the specified bucket.
+   *
+   * @param  bucket  The bucket index.
+   * @return the largest latency in nanoseconds.
+   */
+  static uint64_t GetBucketLimit(size_t bucket);
+
+  /**
+   * Returns the latency at the specified percentile of the bucket counts.
+   *
+   * @param  counts  The bucket counts.
+   * @param  percentile  The percentile between 0 and 1.
+   * @return the largest latency of the percentile's bucket in nanoseconds.
+   */
+  static uint64_t GetPercentile(const counts_t& counts, double percentile);
+
+ protected:
+  std::array<std::atomic<uint64_t>, kBucketCount> counts_;
+  std::atomic<uint64_t> sum_;
+
+};
+
+/**
+ * Latencies and counters of the requests of one worker thread. Each worker
+ * records into its own stats without locking and every stats of the process
+ * can be exported at any time without pausing the workers.
+ */
+class WorkerStats {
+ public:
+  // The directions stages are followed by these request stages
+  enum RequestStage {
+    kParse = StageTimes::kStageCount,
+    kSerialize,
+    kRequest,
+    kHistogramCount
+  };
+
+  WorkerStats();
+  ~WorkerStats();
+
+  WorkerStats(const WorkerStats&) = delete;
+  WorkerStats& operator=(const WorkerStats&) = delete;
+
+  /**
+   * Records the latency of a stage.
+   *
+   * @param  histogram  The directions stage or the request stage.
+   * @param  nanoseconds  The latency.
+   */
+  void Record(size_t histogram, uint64_t nanoseconds);
+
+  /**
+   * Records the latency of every directions stage of a leg.
+   *
+   * @param  stage_times  The stage times of the leg.
+   */
+  void Record(const StageTimes& stage_times);
+
+  void RecordRequest(const std::string& language);
+  void RecordLeg(uint32_t node_count, uint32_t maneuver_count);
+  void RecordError(uint32_t error_code);
+
+  /**
+   * Returns the stats of every worker of the process as a json object.
+   *
+   * @return the json stats.
+   */
+  static std::string ToJson();
+
+  /**
+   * Returns true once per interval for the whole process so that a single
+   * worker exports the stats.
+   *
+   * @param  interval_seconds  The export interval.
+   * @return true if the stats are due.
+   */
+  static bool IsExportDue(uint32_t interval_seconds);
+
+  static const char* GetHistogramName(size_t histogram);
+
+ protected:
+  // Odin error codes are 200 to 299
+  static constexpr uint32_t kFirstErrorCode = 200;
+  static constexpr size_t kErrorCodeCount = 100;
+
+  // Increments a counter only written by the owner thread
+  static void Increment(std::atomic<uint64_t>& counter, uint64_t value = 1);
+
+  std::array<LatencyHistogram, kHistogramCount> histograms_;
+  std::atomic<uint64_t> requests_;
+  std::atomic<uint64_t> legs_;
+  std::atomic<uint64_t> nodes_;
+  std::atomic<uint64_t> maneuvers_;
+  std::array<std::atomic<uint64_t>, kErrorCodeCount> errors_;
+
+  // Indexed like the sorted supported locales
+  std::vector<std::atomic<uint64_t> > locales_;
+
+};
+
+}
+}
+
+#endif  // VALHALLA_ODIN_WORKER_STATS_H_